@@ -160,6 +160,9 @@
 # ifdef WAV_COUPLING
       USE ocean_coupler_mod, ONLY : initialize_ocn2wav_coupling
 # endif
+#endif
+#ifdef LANCZOS_BINARY
+      USE lanczos_bin_mod,   ONLY : get_lanczos_coef
 #endif
       USE strings_mod,       ONLY : FoundError
 !
@@ -286,9 +289,18 @@
 !  the tangent linear model initial conditions as the weighted sum
 !  of the Lanczos vectors. The weighting coefficient are computed
 !  by solving a tri-diagonal system that uses cg_beta and cg_gamma.
+!  If LANCZOS_BINARY, they are read from the binary file written next
+!  to LCZ(ng)%name by the I4D-Var analysis.
 !-----------------------------------------------------------------------
 !
       SourceFile=__FILE__ // ", ROMS_initialize"
+#ifdef LANCZOS_BINARY
+      DO ng=1,Ngrids
+        CALL get_lanczos_coef (ng, iADM)
+        IF (FoundError(exit_flag, NoError, __LINE__,                    &
+     &                 __FILE__)) RETURN
+      END DO
+#else
       DO ng=1,Ngrids
         CALL netcdf_get_fvar (ng, iADM, LCZ(ng)%name, 'cg_beta',        &
      &                        cg_beta)
@@ -299,6 +311,7 @@
         IF (FoundError(exit_flag, NoError, __LINE__,                    &
      &                 __FILE__)) RETURN
       END DO
+#endif
 
 #ifdef SKIP_NLM
 !
@@ -87,6 +87,9 @@
 # ifdef WAV_COUPLING
       USE ocean_coupler_mod, ONLY : initialize_ocn2wav_coupling
 # endif
+#endif
+#if defined LANCZOS_BINARY && !defined RECOMPUTE_4DVAR
+      USE lanczos_bin_mod,   ONLY : get_lanczos_bin
 #endif
       USE strings_mod,       ONLY : FoundError
 !
@@ -220,6 +223,13 @@
 !-----------------------------------------------------------------------
 !
       SourceFile=__FILE__ // ", ROMS_initialize"
+# ifdef LANCZOS_BINARY
+      DO ng=1,Ngrids
+        CALL get_lanczos_bin (ng, iTLM)
+        IF (FoundError(exit_flag, NoError, __LINE__,                    &
+     &                 __FILE__)) RETURN
+      END DO
+# else
       DO ng=1,Ngrids
         CALL netcdf_get_fvar (ng, iTLM, LCZ(ng)%name, 'cg_beta',        &
      &                        cg_beta)
@@ -262,6 +272,7 @@
         IF (FoundError(exit_flag, NoError, __LINE__,                    &
      &                 __FILE__)) RETURN
       END DO
+# endif
 #endif
 !
 !-----------------------------------------------------------------------
@@ -89,6 +89,9 @@
 # ifdef WAV_COUPLING
       USE ocean_coupler_mod, ONLY : initialize_ocn2wav_coupling
 # endif
+#endif
+#if defined LANCZOS_BINARY && !defined OBS_SPACE
+      USE lanczos_bin_mod,   ONLY : get_lanczos_bin
 #endif
       USE strings_mod,       ONLY : FoundError
 !
@@ -223,6 +226,13 @@
 !
       SourceFile=__FILE__ //                                            &
      &           ", ROMS_initialize"
+# ifdef LANCZOS_BINARY
+      DO ng=1,Ngrids
+        CALL get_lanczos_bin (ng, iTLM)
+        IF (FoundError(exit_flag, NoError, __LINE__,                    &
+     &                 __FILE__)) RETURN
+      END DO
+# else
       DO ng=1,Ngrids
         CALL netcdf_get_fvar (ng, iTLM, LCZ(ng)%name, 'cg_beta',        &
      &                        cg_beta)
@@ -281,6 +291,7 @@
      &                 __FILE__)) RETURN
 # endif
       END DO
+# endif
 !
 !-----------------------------------------------------------------------
 !  If skiping runing nonlinear model, read in observation screening and
@@ -375,6 +386,9 @@
       USE convolve_mod,      ONLY : error_covariance
       USE ini_adjust_mod,    ONLY : load_ADtoTL
       USE ini_adjust_mod,    ONLY : load_TLtoAD
+#if defined LANCZOS_BINARY && defined OBS_SPACE
+      USE lanczos_bin_mod,   ONLY : get_lanczos_bin
+#endif
 #ifdef ADJUST_BOUNDARY
       USE mod_boundary,      ONLY : initialize_boundary
 #endif
@@ -1266,6 +1280,13 @@
 !-----------------------------------------------------------------------
 !
         SourceFile=__FILE__ // ", ROMS_initialize"
+# ifdef LANCZOS_BINARY
+        DO ng=1,Ngrids
+          CALL get_lanczos_bin (ng, iTLM)
+          IF (FoundError(exit_flag, NoError, __LINE__,                  &
+     &                   __FILE__)) RETURN
+        END DO
+# else
         DO ng=1,Ngrids
           CALL netcdf_get_fvar (ng, iTLM, LCZ(ng)%name, 'cg_beta',      &
      &                          cg_beta)
@@ -1324,6 +1345,7 @@
      &                   __FILE__)) RETURN
 # endif
         END DO
+# endif
 !
 !-----------------------------------------------------------------------
 !  If skiping runing nonlinear model, read in observation screening and
@@ -0,0 +1,692 @@
+      MODULE ocean_control_mod
+!
+!git $Id$
+!svn $Id$
+!================================================== Hernan G. Arango ===
+!  Copyright (c) 2002-2020 The ROMS/TOMS Group                         !
+!    Licensed under a MIT/X style license                              !
+!    See License_ROMS.txt                                              !
+!=======================================================================
+!                                                                      !
+!  ROMS/TOMS Parareal Parallel-in-Time Nonlinear Model Driver:         !
+!                                                                      !
+!  This driver integrates the nonlinear model over NTIMES timesteps    !
+!  split into "Nslices" time slices of equal length using the Parareal !
+!  algorithm (Lions et al., 2001):                                     !
+!                                                                      !
+!    U(n+1,k+1) = G(U(n,k+1)) + F(U(n,k)) - G(U(n,k))                  !
+!                                                                      !
+!  where U(n,k) is the state at the start of slice n for iteration k,  !
+!  F is the fine propagator (nonlinear model with timestep DT), and G  !
+!  is the coarse propagator (nonlinear model with timestep DT times    !
+!  "ParaRatio").  The inexpensive coarse sweep is sequential and it    !
+!  is computed redundantly by every slice, whereas the fine slices are !
+!  integrated concurrently.  The iterations stop when the maximum      !
+!  relative change of the slice boundary states is less or equal than !
+!  "ParaTol", after "ParaIter" iterations, or after "Nslices"          !
+!  iterations since the solution is then the sequential one.  Then,    !
+!  a final fine integration of each slice writes the output NetCDF     !
+!  files, tagged by slice number.                                      !
+!                                                                      !
+!  In distributed-memory, the processes are split in "Nslices"         !
+!  disjointed subgroups (DISJOINTED), each having NtileI*NtileJ        !
+!  processes and integrating one time slice. Otherwise, the fine       !
+!  slices are integrated one after the other, which is only useful     !
+!  for testing. It follows ESMF conventions:                           !
+!                                                                      !
+!     ROMS_initialize                                                  !
+!     ROMS_run                                                         !
+!     ROMS_finalize                                                    !
+!                                                                      !
+!  Reference:                                                          !
+!                                                                      !
+!    Lions, J.-L., Y. Maday, and G. Turinici, 2001: A "parareal" in    !
+!      time discretization of PDE's, C. R. Acad. Sci. Paris, Serie I,  !
+!      332, 661-668.                                                   !
+!                                                                      !
+!=======================================================================
+!
+      implicit none
+
+      PRIVATE
+      PUBLIC  :: ROMS_initialize
+      PUBLIC  :: ROMS_run
+      PUBLIC  :: ROMS_finalize
+
+      CONTAINS
+
+      SUBROUTINE ROMS_initialize (first, mpiCOMM)
+!
+!=======================================================================
+!                                                                      !
+!  This routine allocates and initializes ROMS/TOMS state variables    !
+!  and internal and external parameters.                               !
+!                                                                      !
+!=======================================================================
+!
+      USE mod_param
+      USE mod_parallel
+      USE mod_iounits
+      USE mod_parareal
+      USE mod_scalars
+!
+      USE inp_par_mod, ONLY : inp_par
+      USE strings_mod, ONLY : FoundError
+!
+!  Imported variable declarations.
+!
+      logical, intent(inout) :: first
+
+      integer, intent(in), optional :: mpiCOMM
+!
+!  Local variable declarations.
+!
+      logical :: allocate_vars = .TRUE.
+
+#ifdef DISTRIBUTE
+      integer :: MyError, MySize
+#endif
+      integer :: chunk_size, ng, thread
+#ifdef _OPENMP
+      integer :: my_threadnum
+#endif
+
+#ifdef DISTRIBUTE
+!
+!-----------------------------------------------------------------------
+!  Set distribute-memory (mpi) world communictor.
+!-----------------------------------------------------------------------
+!
+      IF (PRESENT(mpiCOMM)) THEN
+        OCN_COMM_WORLD=mpiCOMM
+      ELSE
+        OCN_COMM_WORLD=MPI_COMM_WORLD
+      END IF
+      CALL mpi_comm_rank (OCN_COMM_WORLD, MyRank, MyError)
+      CALL mpi_comm_size (OCN_COMM_WORLD, MySize, MyError)
+#endif
+!
+!-----------------------------------------------------------------------
+!  On first pass, initialize model parameters a variables for all
+!  nested/composed grids.
+!-----------------------------------------------------------------------
+!
+      IF (first) THEN
+        first=.FALSE.
+!
+!  Initialize parallel control switches. These scalars switches are
+!  independent from standard input parameters.
+!
+        CALL initialize_parallel
+!
+!  Read in model tunable parameters from standard input. Allocate and
+!  initialize variables in several modules after the number of nested
+!  grids and dimension parameters are known.  If DISJOINTED, the
+!  communicator is split into the time slices subgroups when the
+!  "Nslices" parameter is processed.
+!
+        CALL inp_par (iNLM)
+        IF (FoundError(exit_flag, NoError, __LINE__,                    &
+     &                 __FILE__)) RETURN
+!
+!  Check Parareal parameters.
+!
+        DO ng=1,Ngrids
+          IF ((MOD(ntimes(ng),Nslices).ne.0).or.                        &
+     &        (MOD(ntimes(ng)/Nslices,ParaRatio).ne.0)) THEN
+            IF (Master) WRITE (stdout,10) ng, ntimes(ng), Nslices,      &
+     &                                    ParaRatio
+            exit_flag=5
+            RETURN
+          END IF
+        END DO
+
+#if defined DISTRIBUTE && defined DISJOINTED
+!
+!  Create the communicator between processes holding the same tile in
+!  each time slice subgroup.  It is used to gather the fine propagator
+!  solutions.
+!
+        CALL mpi_comm_split (FULL_COMM_WORLD, MyRank, ForkColor,        &
+     &                       SLICE_COMM_WORLD, MyError)
+#endif
+!
+!  Set domain decomposition tile partition range.  This range is
+!  computed only once since the "first_tile" and "last_tile" values
+!  are private for each parallel thread/node.
+!
+!$OMP PARALLEL
+#if defined _OPENMP
+      MyThread=my_threadnum()
+#elif defined DISTRIBUTE
+      MyThread=MyRank
+#else
+      MyThread=0
+#endif
+      DO ng=1,Ngrids
+        chunk_size=(NtileX(ng)*NtileE(ng)+numthreads-1)/numthreads
+        first_tile(ng)=MyThread*chunk_size
+        last_tile (ng)=first_tile(ng)+chunk_size-1
+      END DO
+!$OMP END PARALLEL
+!
+!  Initialize internal wall clocks. Notice that the timings does not
+!  includes processing standard input because several parameters are
+!  needed to allocate clock variables.
+!
+        IF (Master) THEN
+          WRITE (stdout,20)
+        END IF
+!
+        DO ng=1,Ngrids
+!$OMP PARALLEL
+          DO thread=THREAD_RANGE
+            CALL wclock_on (ng, iNLM, 0, __LINE__, __FILE__)
+          END DO
+!$OMP END PARALLEL
+        END DO
+!
+!  Allocate and initialize all model state arrays and Parareal slice
+!  boundary states.
+!
+!$OMP PARALLEL
+        CALL mod_arrays (allocate_vars)
+!$OMP END PARALLEL
+        DO ng=1,Ngrids
+          CALL allocate_parareal (ng)
+        END DO
+      END IF
+!
+!  Initialize run counter.
+!
+      Nrun=1
+!
+ 10   FORMAT (/,' ROMS_INITIALIZE - illegal Parareal configuration, ',  &
+     &        'Grid ',i2.2,/,19x,'NTIMES = ',i0,', Nslices = ',i0,      &
+     &        ', ParaRatio = ',i0,/,19x,                                &
+     &        'NTIMES must be a multiple of Nslices and NTIMES/Nslices',&
+     &        ' a multiple of ParaRatio.')
+ 20   FORMAT (/,' Process Information:',/)
+
+      RETURN
+      END SUBROUTINE ROMS_initialize
+
+      SUBROUTINE ROMS_run (RunInterval)
+!
+!=======================================================================
+!                                                                      !
+!  This routine runs the Parareal algorithm over the full simulation   !
+!  interval. The RunInterval argument is not used since the interval   !
+!  is divided in time slices.                                          !
+!                                                                      !
+!=======================================================================
+!
+      USE mod_param
+      USE mod_parallel
+      USE mod_iounits
+      USE mod_parareal
+      USE mod_scalars
+!
+#ifdef DISTRIBUTE
+      USE distribute_mod, ONLY : mp_reduce
+#endif
+      USE strings_mod,    ONLY : FoundError
+!
+!  Imported variable declarations.
+!
+      real(dp), intent(in) :: RunInterval            ! seconds
+!
+!  Local variable declarations.
+!
+      logical :: Lconverged
+
+      integer :: i, iter, islice, ng, nv
+#if defined DISTRIBUTE && defined DISJOINTED
+      integer :: MyError
+#endif
+      integer :: Nfine(Ngrids), ntimesF(Ngrids)
+
+      real(r8) :: ParaError
+
+      real(r8) :: dtF(Ngrids)
+      real(r8), allocatable :: Rchange(:)
+
+      character (len=3), allocatable :: op_handle(:)
+!
+!-----------------------------------------------------------------------
+!  Save fine propagator parameters.
+!-----------------------------------------------------------------------
+!
+      DO ng=1,Ngrids
+        dtF(ng)=dt(ng)
+        ntimesF(ng)=ntimes(ng)
+        Nfine(ng)=ntimes(ng)/Nslices
+      END DO
+      nv=MAXVAL(PARA(1:Ngrids)%Nvar)
+      allocate ( Rchange(2*nv) )
+      allocate ( op_handle(2*nv) )
+      op_handle='MAX'
+!
+!-----------------------------------------------------------------------
+!  Iteration zero: sequential coarse propagator sweep to initialize
+!  the slice boundary states.
+!-----------------------------------------------------------------------
+!
+      LparaOut=.FALSE.
+      IF (Master) WRITE (stdout,10) 0
+      DO islice=0,Nslices-1
+        CALL parareal_propagate (islice, ParaRatio, dtF, Nfine)
+        IF (FoundError(exit_flag, NoError, __LINE__,                    &
+     &                 __FILE__)) RETURN
+        DO ng=1,Ngrids
+          PARA(ng)%G(:,islice+1)=PARA(ng)%W
+          PARA(ng)%U(:,islice+1)=PARA(ng)%W
+        END DO
+      END DO
+!
+!-----------------------------------------------------------------------
+!  Parareal iterations.
+!-----------------------------------------------------------------------
+!
+      Lconverged=.FALSE.
+      ITER_LOOP : DO iter=1,MIN(ParaIter,Nslices)
+        IF (Master) WRITE (stdout,10) iter
+!
+!  Integrate fine propagator over the time slices that are not
+!  converged yet. After iteration k, the first k slices are exact.
+!
+#if defined DISTRIBUTE && defined DISJOINTED
+        islice=ForkColor
+        IF (islice.ge.iter-1) THEN
+          CALL parareal_propagate (islice, 1, dtF, Nfine)
+          IF (FoundError(exit_flag, NoError, __LINE__,                  &
+     &                   __FILE__)) RETURN
+          DO ng=1,Ngrids
+            PARA(ng)%F(:,islice)=PARA(ng)%W
+          END DO
+        END IF
+!
+!  Gather fine propagator solutions from all the slices.
+!
+        DO ng=1,Ngrids
+          CALL mpi_allgather (MPI_IN_PLACE, 0, MPI_DATATYPE_NULL,       &
+     &                        PARA(ng)%F, PARA(ng)%Npts, MP_FLOAT,      &
+     &                        SLICE_COMM_WORLD, MyError)
+        END DO
+#else
+        DO islice=iter-1,Nslices-1
+          CALL parareal_propagate (islice, 1, dtF, Nfine)
+          IF (FoundError(exit_flag, NoError, __LINE__,                  &
+     &                   __FILE__)) RETURN
+          DO ng=1,Ngrids
+            PARA(ng)%F(:,islice)=PARA(ng)%W
+          END DO
+        END DO
+#endif
+!
+!  Sequential coarse propagator correction sweep.
+!
+        Rchange=0.0_r8
+        DO islice=0,Nslices-1
+          IF (islice.lt.iter) THEN
+            DO ng=1,Ngrids
+              PARA(ng)%W=PARA(ng)%F(:,islice)
+            END DO
+          ELSE
+            CALL parareal_propagate (islice, ParaRatio, dtF, Nfine)
+            IF (FoundError(exit_flag, NoError, __LINE__,                &
+     &                     __FILE__)) RETURN
+            DO ng=1,Ngrids
+              PARA(ng)%F(:,islice)=PARA(ng)%F(:,islice)-                &
+     &                             PARA(ng)%G(:,islice+1)
+              PARA(ng)%G(:,islice+1)=PARA(ng)%W
+              PARA(ng)%W=PARA(ng)%W+PARA(ng)%F(:,islice)
+            END DO
+          END IF
+          DO ng=1,Ngrids
+            CALL parareal_change (ng, PARA(ng)%W,                       &
+     &                            PARA(ng)%U(:,islice+1), Rchange)
+            PARA(ng)%U(:,islice+1)=PARA(ng)%W
+          END DO
+        END DO
+!
+!  Check convergence: maximum relative change of the slice boundary
+!  states.
+!
+#ifdef DISTRIBUTE
+        CALL mp_reduce (1, iNLM, 2*nv, Rchange, op_handle)
+#endif
+        ParaError=0.0_r8
+        DO i=1,nv
+          IF (Rchange(nv+i).gt.0.0_r8) THEN
+            ParaError=MAX(ParaError, Rchange(i)/Rchange(nv+i))
+          END IF
+        END DO
+        IF (Master) WRITE (stdout,20) iter, ParaError
+        IF ((ParaError.le.ParaTol).or.(iter.eq.Nslices)) THEN
+          Lconverged=.TRUE.
+          EXIT ITER_LOOP
+        END IF
+      END DO ITER_LOOP
+      IF (Master.and.(.not.Lconverged)) WRITE (stdout,30) ParaIter
+!
+!-----------------------------------------------------------------------
+!  Final fine propagator integration writing output NetCDF files.
+!-----------------------------------------------------------------------
+!
+      LparaOut=.TRUE.
+#if defined DISTRIBUTE && defined DISJOINTED
+      islice=ForkColor
+      CALL parareal_names (islice)
+      CALL parareal_propagate (islice, 1, dtF, Nfine)
+      IF (FoundError(exit_flag, NoError, __LINE__,                      &
+     &               __FILE__)) RETURN
+#else
+      DO islice=0,Nslices-1
+        CALL parareal_names (islice)
+        CALL parareal_propagate (islice, 1, dtF, Nfine)
+        IF (FoundError(exit_flag, NoError, __LINE__,                    &
+     &                 __FILE__)) RETURN
+      END DO
+#endif
+!
+!  Restore full simulation parameters.
+!
+      DO ng=1,Ngrids
+        ntimes(ng)=ntimesF(ng)
+      END DO
+      deallocate ( Rchange, op_handle )
+!
+ 10   FORMAT (/,' <<<< Parareal Parallel-in-Time, Iteration = ',i3.3,   &
+     &        ' >>>>',/)
+ 20   FORMAT (/,' PARAREAL - Iteration = ',i3.3,                        &
+     &        ', maximum relative change of slice states = ',1p,e15.8,/)
+ 30   FORMAT (/,' PARAREAL - not converged after ',i0,' iterations',/)
+
+      RETURN
+      END SUBROUTINE ROMS_run
+
+      SUBROUTINE parareal_propagate (islice, ratio, dtF, Nfine)
+!
+!=======================================================================
+!                                                                      !
+!  This routine integrates the nonlinear model over the requested      !
+!  time slice with the timestep size DT times "ratio", starting from   !
+!  the slice boundary state, or from the initial conditions for the    !
+!  first slice. The solution at the end of the slice is packed in the  !
+!  work vector W.                                                      !
+!                                                                      !
+!  On Input:                                                           !
+!                                                                      !
+!     islice     Time slice to integrate, 0:Nslices-1 (integer)        !
+!     ratio      Timestep ratio: 1 fine, ParaRatio coarse (integer)    !
+!     dtF        Fine propagator timestep (real)                       !
+!     Nfine      Number of fine timesteps per slice (integer)          !
+!                                                                      !
+!=======================================================================
+!
+      USE mod_param
+      USE mod_parallel
+      USE mod_iounits
+      USE mod_parareal
+      USE mod_scalars
+!
+#ifdef SOLVE3D
+      USE mod_coupling, ONLY : initialize_coupling
+#endif
+      USE mod_mixing,   ONLY : initialize_mixing
+      USE mod_ocean,    ONLY : initialize_ocean
+      USE strings_mod,  ONLY : FoundError
+!
+!  Imported variable declarations.
+!
+      integer, intent(in) :: islice, ratio
+      integer, intent(in) :: Nfine(Ngrids)
+
+      real(r8), intent(in) :: dtF(Ngrids)
+!
+!  Local variable declarations.
+!
+      integer :: ng, tile
+!
+!-----------------------------------------------------------------------
+!  Set timestep size, number of timesteps, and starting time. The
+!  initial time of the first slice is set in "initial" and saved in
+!  Tstart.
+!-----------------------------------------------------------------------
+!
+      MyRunInterval=0.0_dp
+      DO ng=1,Ngrids
+        dt(ng)=dtF(ng)*REAL(ratio,r8)
+        dtfast(ng)=dt(ng)/REAL(ndtfast(ng),r8)
+        ntimes(ng)=Nfine(ng)/ratio
+        IF (islice.eq.0) THEN
+          INItime(ng)=-1.0_dp
+        ELSE
+          INItime(ng)=PARA(ng)%Tstart+REAL(islice*Nfine(ng),dp)*dtF(ng)
+        END IF
+        MyRunInterval=MAX(MyRunInterval, dt(ng)*ntimes(ng))
+      END DO
+      Pslice=islice
+      LparaLoad=islice.gt.0
+!
+!-----------------------------------------------------------------------
+!  Initialize and time-step nonlinear model.  Clear state and mixing
+!  arrays first, so every integration of the slice starts from the
+!  same conditions as a fresh run.
+!-----------------------------------------------------------------------
+!
+      DO ng=1,Ngrids
+!$OMP PARALLEL
+        DO tile=first_tile(ng),last_tile(ng),+1
+          CALL initialize_ocean (ng, tile, iNLM)
+#ifdef SOLVE3D
+          CALL initialize_coupling (ng, tile, iNLM)
+#endif
+          CALL initialize_mixing (ng, tile, iNLM)
+        END DO
+!$OMP END PARALLEL
+      END DO
+!
+!$OMP PARALLEL
+      CALL initial
+!$OMP END PARALLEL
+      IF (FoundError(exit_flag, NoError, __LINE__,                      &
+     &               __FILE__)) RETURN
+      IF (islice.eq.0) THEN
+        DO ng=1,Ngrids
+          PARA(ng)%Tstart=INItime(ng)
+        END DO
+      END IF
+!
+      IF (Master) THEN
+        WRITE (stdout,'(1x)')
+        DO ng=1,Ngrids
+          WRITE (stdout,10) islice+1, ratio, ng, ntstart(ng), ntend(ng)
+        END DO
+        WRITE (stdout,'(1x)')
+      END IF
+!
+!$OMP PARALLEL
+#ifdef SOLVE3D
+      CALL main3d (MyRunInterval)
+#else
+      CALL main2d (MyRunInterval)
+#endif
+!$OMP END PARALLEL
+      IF (FoundError(exit_flag, NoError, __LINE__,                      &
+     &               __FILE__)) RETURN
+!
+!-----------------------------------------------------------------------
+!  Pack solution at the end of the slice and restore fine timestep.
+!-----------------------------------------------------------------------
+!
+      DO ng=1,Ngrids
+        CALL parareal_pack (ng, PARA(ng)%W)
+        dt(ng)=dtF(ng)
+        dtfast(ng)=dt(ng)/REAL(ndtfast(ng),r8)
+      END DO
+!
+ 10   FORMAT (1x,'NL ROMS/TOMS: started time-stepping: Slice ',i3.3,    &
+     &        ' Ratio ',i3.3,' (Grid: ',i2.2,' TimeSteps: ',i12.12,     &
+     &        ' - ',i12.12,')')
+
+      RETURN
+      END SUBROUTINE parareal_propagate
+
+      SUBROUTINE parareal_names (islice)
+!
+!=======================================================================
+!                                                                      !
+!  This routine tags the output NetCDF file names with the time slice  !
+!  number, so each slice writes its own files: "ocean_his.nc" becomes  !
+!  "ocean_his_s001.nc".                                                !
+!                                                                      !
+!=======================================================================
+!
+      USE mod_param
+      USE mod_iounits
+!
+!  Imported variable declarations.
+!
+      integer, intent(in) :: islice
+!
+!  Local variable declarations.
+!
+      integer :: ng
+
+      character (len=5) :: tag
+!
+!-----------------------------------------------------------------------
+!  Tag output file names.
+!-----------------------------------------------------------------------
+!
+      WRITE (tag,'(a,i3.3)') '_s', islice+1
+      DO ng=1,Ngrids
+        CALL tag_name (HIS(ng))
+        CALL tag_name (QCK(ng))
+        CALL tag_name (RST(ng))
+#ifdef AVERAGES
+        CALL tag_name (AVG(ng))
+#endif
+#ifdef DIAGNOSTICS
+        CALL tag_name (DIA(ng))
+#endif
+#ifdef STATIONS
+        CALL tag_name (STA(ng))
+#endif
+#ifdef FLOATS
+        CALL tag_name (FLT(ng))
+#endif
+      END DO
+
+      RETURN
+
+      CONTAINS
+
+      SUBROUTINE tag_name (S)
+!
+!  Insert slice tag to file base name and current file name.
+!
+      TYPE(T_IO), intent(inout) :: S
+
+      integer :: is
+
+      is=INDEX(S%base, tag, BACK=.TRUE.)
+      IF (is.gt.0) S%base(is:)=' '
+      S%base=TRIM(S%base)//tag
+      is=INDEX(S%name, '_s', BACK=.TRUE.)
+      IF ((is.gt.0).and.(INDEX(S%name(is:), '.nc').eq.6)) THEN
+        S%name(is:)=S%name(is+5:)
+      END IF
+      is=INDEX(S%name, '.nc', BACK=.TRUE.)
+      IF (is.gt.0) THEN
+        S%name=S%name(1:is-1)//tag//'.nc'
+      ELSE
+        S%name=TRIM(S%name)//tag
+      END IF
+
+      RETURN
+      END SUBROUTINE tag_name
+
+      END SUBROUTINE parareal_names
+
+      SUBROUTINE ROMS_finalize
+!
+!=======================================================================
+!                                                                      !
+!  This routine terminates ROMS/TOMS nonlinear model execution.        !
+!                                                                      !
+!=======================================================================
+!
+      USE mod_param
+      USE mod_parallel
+      USE mod_iounits
+      USE mod_ncparam
+      USE mod_scalars
+!
+!  Local variable declarations.
+!
+      integer :: Fcount, ng, thread
+!
+!-----------------------------------------------------------------------
+!  If blowing-up, save latest model state into RESTART NetCDF file.
+!-----------------------------------------------------------------------
+!
+!  If cycling restart records, write solution into the next record.
+!
+      IF (exit_flag.eq.1) THEN
+        DO ng=1,Ngrids
+          IF (LwrtRST(ng)) THEN
+            IF (Master) WRITE (stdout,10) TRIM(blowup_string)
+ 10         FORMAT (/,' Blowing-up: Saving latest model state into ',   &
+     &                ' RESTART file',/,'     REASON: ',a,/)
+            Fcount=RST(ng)%load
+            IF (LcycleRST(ng).and.(RST(ng)%Nrec(Fcount).ge.2)) THEN
+              RST(ng)%Rindex=2
+              LcycleRST(ng)=.FALSE.
+            END IF
+            blowup=exit_flag
+            exit_flag=NoError
+            CALL wrt_rst (ng)
+          END IF
+        END DO
+      END IF
+!
+!-----------------------------------------------------------------------
+!  Stop model and time profiling clocks, report memory requirements, and
+!  close output NetCDF files.
+!-----------------------------------------------------------------------
+!
+!  Stop time clocks.
+!
+      IF (Master) THEN
+        WRITE (stdout,20)
+ 20     FORMAT (/,'Elapsed wall CPU time for each process (seconds):',/)
+      END IF
+!
+      DO ng=1,Ngrids
+!$OMP PARALLEL
+        DO thread=THREAD_RANGE
+          CALL wclock_off (ng, iNLM, 0, __LINE__, __FILE__)
+        END DO
+!$OMP END PARALLEL
+      END DO
+!
+!  Report dynamic memory and automatic memory requirements.
+!
+!$OMP PARALLEL
+      CALL memory
+!$OMP END PARALLEL
+!
+!  Close IO files.
+!
+      DO ng=1,Ngrids
+        CALL close_inp (ng, iNLM)
+      END DO
+      CALL close_out
+
+      RETURN
+      END SUBROUTINE ROMS_finalize
+
+      END MODULE ocean_control_mod
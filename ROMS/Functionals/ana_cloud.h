@@ -21,6 +21,16 @@
       integer, intent(in) :: ng, tile, model
 
 #include "tile.h"
+#ifdef ANA_FRCCACHE
+!
+!  Declare field time dependence and skip evaluation if still current.
+!
+# ifdef PAPA_CLM
+      IF (ana_cached(ng, tile, model,  4, ANAstep)) RETURN
+# else
+      IF (ana_cached(ng, tile, model,  4, ANAconst)) RETURN
+# endif
+#endif
 !
       CALL ana_cloud_tile (ng, tile, model,                             &
      &                     LBi, UBi, LBj, UBj,                          &
@@ -23,6 +23,12 @@
       integer, intent(in) :: ng, tile, model
 
 #include "tile.h"
+#ifdef ANA_FRCCACHE
+!
+!  Declare field time dependence and skip evaluation if still current.
+!
+      IF (ana_cached(ng, tile, model, 24, ANAstep)) RETURN
+#endif
 !
       CALL ana_smflux_tile (ng, tile, model,                            &
      &                      LBi, UBi, LBj, UBj,                         &
@@ -22,6 +22,12 @@
       integer, intent(in) :: ng, tile, model
 
 #include "tile.h"
+#ifdef ANA_FRCCACHE
+!
+!  Declare field time dependence and skip evaluation if still current.
+!
+      IF (ana_cached(ng, tile, model, 32, ANAconst)) RETURN
+#endif
 !
       CALL ana_tair_tile (ng, tile, model,                              &
      &                    LBi, UBi, LBj, UBj,                           &
@@ -56,6 +56,7 @@
 ** TS_DIF2                 to turn ON or OFF harmonic horizontal mixing      **
 ** TS_DIF4                 to turn ON or OFF biharmonic horizontal mixing    **
 ** TS_SMAGORINSKY          to turn ON or OFF Smagorinsky-like diffusion      **
+** SMAGORINSKY_FUSED       if Smagorinsky coefs computed in mixing ops       **
 ** TS_FIXED                if diagnostic run, no evolution of tracers        **
 ** T_PASSIVE               if inert passive tracers (dyes, etc)              **
 ** AGE_MEAN                if computing Mean Age of inert passive tracers    **
@@ -66,6 +67,7 @@
 ** SOLAR_SOURCE            if solar radiation source term                    **
 ** SPLINES_VDIFF           if splines reconstruction of vertical diffusion   **
 ** SRELAXATION             if salinity relaxation as a freshwater flux       **
+** TS_VADV_ADAPT_IMP       if adaptively implicit vertical tracer advection  **
 ** WTYPE_GRID              to turn ON spatially varying Jerlov water type    **
 **                                                                           **
 ** OPTION to suppress further surface cooling if the SST is at freezing      **
@@ -172,6 +174,7 @@
 ** ANA_DQDSST              if analytical surface heat flux sensitivity to SST**
 ** ANA_DRAG                if analytical spatially varying drag parameters   **
 ** ANA_FSOBC               if analytical free-surface boundary conditions    **
+** ANA_FRCCACHE            if skipping time-invariant analytical forcing     **
 ** ANA_GRID                if analytical model grid set-up                   **
 ** ANA_HUMIDITY            if analytical surface air humidity                **
 ** ANA_INITIAL             if analytical initial conditions                  **
@@ -356,6 +359,7 @@
 ** LCZ_FINAL                  it computing 4D-Var Hessian singular vectors   **
 ** OPT_OBSERVATIONS           if optimal observations                        **
 ** OPT_PERTURBATION           if optimal perturbations, singular vectors     **
+** PARAREAL                   if Parareal parallel-in-time nonlinear driver  **
 ** PICARD_TEST                if representer tangent linear model test       **
 ** PSEUDOSPECTRA              if pseudospectra of tangent linear resolvant   **
 ** RBL4DVAR                   if weak constraint RBL4D-Var data assimilation **
@@ -392,6 +396,7 @@
 ** CLIPPING_SPLIT          to separate analysis due to IC, forcing, and OBC  **
 ** DATALESS_LOOPS          if testing convergence of Picard iterations       **
 ** ENKF_RESTART            if writting restart fields for EnKF               **
+** FORWARD_CACHE           if caching forward and forcing records in memory  **
 ** FORWARD_MIXING          if processing forward vertical mixing coefficient **
 ** FORWARD_WRITE           if writing out forward solution, basic state      **
 ** FORWARD_READ            if reading in  forward solution, basic state      **
@@ -400,9 +405,12 @@
 ** IMPACT_INNER            to write observations impacts for each inner loop **
 ** IMPLICIT_VCONV          if implicit vertical convolution algorithm        **
 ** IMPULSE                 if processing adjoint impulse forcing             **
+** LANCZOS_BINARY          if binary Lanczos basis for observation impact    **
+** LANCZOS_INCORE          if keeping I4DVAR Lanczos vectors in memory       **
 ** MINRES                  if Minimal Residual Method for 4DVar minimization **
 ** MULTIPLE_TLM            if multiple TLM history files in 4DVAR            **
 ** NLM_OUTER               if nonlinear model as basic state in outer loop   **
+** OBS_CACHE               if loading all observations into memory once      **
 ** OBS_IMPACT              if observation impact to 4DVAR data assimilation  **
 ** OBS_IMPACT_SPLIT        to separate impact due to IC, forcing, and OBC    **
 ** POSTERIOR_EOFS          if posterior analysis error covariance EOFS       **
@@ -430,6 +438,7 @@
 ** Fennel et al. (2006) biology model OPTIONS:                               **
 **                                                                           **
 ** BIO_FENNEL              if Fennel et al. (2006) nitrogen-based model      **
+** BIO_COARSE              if source/sink terms on a coarser biology grid    **
 ** BIO_SEDIMENT            to restore fallen material to the nutrient pool   **
 ** CARBON                  to add carbon constituents                        **
 ** DENITRIFICATION         to add denitrification processes                  **
@@ -546,6 +555,7 @@
 **                                                                           **
 ** DEFLATE                 to set compression NetCDF-4/HDF5 format files     **
 ** HDF5                    to create NetCDF-4/HDF5 format files              **
+** NETCDF_CACHE            if caching input NetCDF files metadata            **
 ** NO_LBC_ATT              to not check NLM_LBC global attribute on restart  **
 ** NO_READ_GHOST           to not include ghost points during read/scatter   **
 ** NO_WRITE_GRID           if not writing grid arrays                        **
@@ -554,6 +564,7 @@
 ** PNETCDF                 if parallel I/O with pnetcdf (classic format)     **
 ** POSITIVE_ZERO           to impose positive zero in ouput data             **
 ** READ_WATER              if only reading water points data                 **
+** REGRID_CACHE            if caching regridding weights of input data       **
 ** WRITE_WATER             if only writing water points data                 **
 ** RST_SINGLE              if writing single precision restart fields        **
 ** OUT_DOUBLE              if writing double precision output fields         **
@@ -564,6 +575,12 @@
 **                                                                           **
 ** INLINE_2DIO             if processing 3D IO level by level                **
 **                                                                           **
+** OPTION to read input scripts only in the master node and broadcast        **
+** their text in distributed-memory configurations. It reduces the shared    **
+** file system access during start-up in large MPI applications.             **
+**                                                                           **
+** INPUT_BCAST             if broadcasting input scripts from master node    **
+**                                                                           **
 ** OPTION to avoid writing current date and CPP options to NetCDF file       **
 ** headers. This is used to compare serial and parallel solutions where      **
 ** the UNIX command "diff" is used between NetCDF files. It will only        **
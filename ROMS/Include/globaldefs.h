@@ -1108,3 +1108,23 @@
 #if !defined VISC_3DCOEF && defined UV_SMAGORINSKY
 # define VISC_3DCOEF
 #endif
+
+/*
+** Define internal switches to compute the harmonic Smagorinsky-like
+** coefficients on the fly in the nonlinear S-surfaces mixing operators
+** instead of storing them in 3D arrays.  It is not available in the
+** adjoint-based algorithms since the tangent linear and adjoint models
+** need the stored nonlinear coefficients.
+*/
+
+#if defined SMAGORINSKY_FUSED && \
+    !(defined TANGENT || defined TL_IOMS || defined ADJOINT)
+# if defined UV_SMAGORINSKY && defined UV_VIS2 && \
+     !defined UV_VIS4       && defined MIX_S_UV
+#  define VISC_3DFUSED
+# endif
+# if defined TS_SMAGORINSKY && defined TS_DIF2 && \
+     !defined TS_DIF4       && defined MIX_S_TS
+#  define DIFF_3DFUSED
+# endif
+#endif
@@ -11,15 +11,26 @@
 **
 ** Application flag:   OVERFLOW
 ** Input script:       roms_overflow.in
+**                     roms_overflow_vadv.in  (TS_VADV_ADAPT_IMP)
+**
+** If TS_VADV_ADAPT_IMP, the test is run with thin layers and a large
+** time-step so the vertical Courant number exceeds one over the slope.
+** The momentum advection is turned off since its vertical component is
+** still fully explicit.  The implicit vertical diffusion is solved with
+** the tridiagonal solver.
 */
 
-#define UV_ADV
+#ifndef TS_VADV_ADAPT_IMP
+# define UV_ADV
+#endif
 #define UV_COR
 #define UV_QDRAG
 #define UV_VIS2
 #define MIX_S_UV
 #define DJ_GRADPS
-#define SPLINES_VDIFF
+#ifndef TS_VADV_ADAPT_IMP
+# define SPLINES_VDIFF
+#endif
 #define SPLINES_VVISC
 #define TS_DIF2
 #define MIX_ISO_TS
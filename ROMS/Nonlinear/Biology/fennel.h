@@ -71,6 +71,9 @@
 !***********************************************************************
 !
       USE mod_param
+#ifdef BIO_COARSE
+      USE mod_biology
+#endif
 #ifdef DIAGNOSTICS_BIO
       USE mod_diags
 #endif
@@ -103,10 +106,60 @@
 !
 #ifdef PROFILE
       CALL wclock_on (ng, iNLM, 15, __LINE__, __FILE__)
+#endif
+#ifdef BIO_COARSE
+!
+!  If appropriate, compute source/sink terms on the coarse biology grid.
+!
+      IF (BioCoarse(ng).gt.1) THEN
+        CALL biology_coarse (ng, tile,                                  &
+     &                       LBi, UBi, LBj, UBj, N(ng), NT(ng),         &
+     &                       nstp(ng), nnew(ng),                        &
+# ifdef MASKING
+     &                       GRID(ng) % rmask,                          &
+#  ifdef WET_DRY
+     &                       GRID(ng) % rmask_wet,                      &
+#   ifdef DIAGNOSTICS_BIO
+     &                       GRID(ng) % rmask_full,                     &
+#   endif
+#  endif
+# endif
+     &                       GRID(ng) % pm,                             &
+     &                       GRID(ng) % pn,                             &
+     &                       GRID(ng) % Hz,                             &
+     &                       GRID(ng) % z_r,                            &
+     &                       GRID(ng) % z_w,                            &
+     &                       FORCES(ng) % srflx,                        &
+# if defined CARBON || defined OXYGEN
+#  ifdef BULK_FLUXES
+     &                       FORCES(ng) % Uwind,                        &
+     &                       FORCES(ng) % Vwind,                        &
+#  else
+     &                       FORCES(ng) % sustr,                        &
+     &                       FORCES(ng) % svstr,                        &
+#  endif
+# endif
+# ifdef CARBON
+     &                       OCEAN(ng) % pH,                            &
+# endif
+# ifdef DIAGNOSTICS_BIO
+     &                       DIAGS(ng) % DiaBio2d,                      &
+     &                       DIAGS(ng) % DiaBio3d,                      &
+# endif
+     &                       OCEAN(ng) % t)
+# ifdef PROFILE
+        CALL wclock_off (ng, iNLM, 15, __LINE__, __FILE__)
+# endif
+        RETURN
+      END IF
 #endif
       CALL biology_tile (ng, tile,                                      &
      &                   LBi, UBi, LBj, UBj, N(ng), NT(ng),             &
      &                   IminS, ImaxS, JminS, JmaxS,                    &
+     &                   BOUNDS(ng) % Istr(tile),                       &
+     &                   BOUNDS(ng) % Iend(tile),                       &
+     &                   BOUNDS(ng) % Jstr(tile),                       &
+     &                   BOUNDS(ng) % Jend(tile),                       &
      &                   nstp(ng), nnew(ng),                            &
 #ifdef MASKING
      &                   GRID(ng) % rmask,                              &
@@ -145,11 +198,412 @@
 
       RETURN
       END SUBROUTINE biology
+#ifdef BIO_COARSE
+!
+!-----------------------------------------------------------------------
+      SUBROUTINE biology_coarse (ng, tile,                              &
+     &                           LBi, UBi, LBj, UBj, UBk, UBt,          &
+     &                           nstp, nnew,                            &
+# ifdef MASKING
+     &                           rmask,                                 &
+#  ifdef WET_DRY
+     &                           rmask_wet,                             &
+#   ifdef DIAGNOSTICS_BIO
+     &                           rmask_full,                            &
+#   endif
+#  endif
+# endif
+     &                           pm, pn, Hz, z_r, z_w, srflx,           &
+# if defined CARBON || defined OXYGEN
+#  ifdef BULK_FLUXES
+     &                           Uwind, Vwind,                          &
+#  else
+     &                           sustr, svstr,                          &
+#  endif
+# endif
+# ifdef CARBON
+     &                           pH,                                    &
+# endif
+# ifdef DIAGNOSTICS_BIO
+     &                           DiaBio2d, DiaBio3d,                    &
+# endif
+     &                           t)
+!-----------------------------------------------------------------------
+!
+!  This routine averages the physical state over blocks of BioCoarse x
+!  BioCoarse grid points, computes the biological source/sink terms on
+!  the resulting coarse grid, and distributes the coarse increments
+!  back to the physical grid.  The blocks are anchored on the domain
+!  interior points (see "bio_coarse_mod"), so the results do not depend
+!  on the partition.  The concentration increment of a block is applied
+!  to all its wet points times their level thickness, so the total
+!  inventory of each block is conserved.  The advection and mixing of
+!  the biological tracers are still computed on the physical grid.
+!
+      USE mod_param
+      USE mod_biology
+      USE mod_scalars
+!
+      USE bio_coarse_mod
+!
+!  Imported variable declarations.
+!
+      integer, intent(in) :: ng, tile
+      integer, intent(in) :: LBi, UBi, LBj, UBj, UBk, UBt
+      integer, intent(in) :: nstp, nnew
+
+# ifdef ASSUMED_SHAPE
+#  ifdef MASKING
+      real(r8), intent(in) :: rmask(LBi:,LBj:)
+#   ifdef WET_DRY
+      real(r8), intent(in) :: rmask_wet(LBi:,LBj:)
+#    ifdef DIAGNOSTICS_BIO
+      real(r8), intent(in) :: rmask_full(LBi:,LBj:)
+#    endif
+#   endif
+#  endif
+      real(r8), intent(in) :: pm(LBi:,LBj:)
+      real(r8), intent(in) :: pn(LBi:,LBj:)
+      real(r8), intent(in) :: Hz(LBi:,LBj:,:)
+      real(r8), intent(in) :: z_r(LBi:,LBj:,:)
+      real(r8), intent(in) :: z_w(LBi:,LBj:,0:)
+      real(r8), intent(in) :: srflx(LBi:,LBj:)
+#  if defined CARBON || defined OXYGEN
+#   ifdef BULK_FLUXES
+      real(r8), intent(in) :: Uwind(LBi:,LBj:)
+      real(r8), intent(in) :: Vwind(LBi:,LBj:)
+#   else
+      real(r8), intent(in) :: sustr(LBi:,LBj:)
+      real(r8), intent(in) :: svstr(LBi:,LBj:)
+#   endif
+#  endif
+#  ifdef CARBON
+      real(r8), intent(inout) :: pH(LBi:,LBj:)
+#  endif
+#  ifdef DIAGNOSTICS_BIO
+      real(r8), intent(inout) :: DiaBio2d(LBi:,LBj:,:)
+      real(r8), intent(inout) :: DiaBio3d(LBi:,LBj:,:,:)
+#  endif
+      real(r8), intent(inout) :: t(LBi:,LBj:,:,:,:)
+# else
+#  ifdef MASKING
+      real(r8), intent(in) :: rmask(LBi:UBi,LBj:UBj)
+#   ifdef WET_DRY
+      real(r8), intent(in) :: rmask_wet(LBi:UBi,LBj:UBj)
+#    ifdef DIAGNOSTICS_BIO
+      real(r8), intent(in) :: rmask_full(LBi:UBi,LBj:UBj)
+#    endif
+#   endif
+#  endif
+      real(r8), intent(in) :: pm(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pn(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: Hz(LBi:UBi,LBj:UBj,UBk)
+      real(r8), intent(in) :: z_r(LBi:UBi,LBj:UBj,UBk)
+      real(r8), intent(in) :: z_w(LBi:UBi,LBj:UBj,0:UBk)
+      real(r8), intent(in) :: srflx(LBi:UBi,LBj:UBj)
+#  if defined CARBON || defined OXYGEN
+#   ifdef BULK_FLUXES
+      real(r8), intent(in) :: Uwind(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: Vwind(LBi:UBi,LBj:UBj)
+#   else
+      real(r8), intent(in) :: sustr(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: svstr(LBi:UBi,LBj:UBj)
+#   endif
+#  endif
+#  ifdef CARBON
+      real(r8), intent(inout) :: pH(LBi:UBi,LBj:UBj)
+#  endif
+#  ifdef DIAGNOSTICS_BIO
+      real(r8), intent(inout) :: DiaBio2d(LBi:UBi,LBj:UBj,NDbio2d)
+      real(r8), intent(inout) :: DiaBio3d(LBi:UBi,LBj:UBj,UBk,NDbio3d)
+#  endif
+      real(r8), intent(inout) :: t(LBi:UBi,LBj:UBj,UBk,3,UBt)
+# endif
+!
+!  Local variable declarations.
+!
+      integer :: Imin, Imax, Jmin, Jmax, Nc
+      integer :: IstrC, IendC, JstrC, JendC
+      integer :: i, ibio, ic, itrc, j, jc, k
+# ifdef DIAGNOSTICS_BIO
+      integer :: ivar
+# endif
+
+      real(r8) :: cff, cff1
+
+      real(r8), dimension(LBi:UBi,LBj:UBj) :: W
+
+# include "set_bounds.h"
+!
+!-----------------------------------------------------------------------
+!  Average physical state over the coarse grid blocks.
+!-----------------------------------------------------------------------
+!
+!  Determine the blocks overlapping the tile.  Their coarse arrays are
+!  allocated on the first call.
+!
+      Nc=BioCoarse(ng)
+      CALL bio_coarse_size (ng, tile, Nc, IstrC, IendC, JstrC, JendC)
+      IF (.not.allocated(BIOGRID(tile,ng)%t)) THEN
+        CALL allocate_biogrid (ng, tile, IstrC, IendC, JstrC, JendC)
+      END IF
+!
+!  Set averaging weights to the wet area of each grid cell.  The blocks
+!  straddling the tile boundaries include points of the halo regions.
+!
+      DO j=(JstrC-1)*Nc+1,MIN(JendC*Nc,Mm(ng))
+        DO i=(IstrC-1)*Nc+1,MIN(IendC*Nc,Lm(ng))
+          W(i,j)=1.0_r8/(pm(i,j)*pn(i,j))
+# ifdef MASKING
+          W(i,j)=W(i,j)*rmask(i,j)
+#  ifdef WET_DRY
+          W(i,j)=W(i,j)*rmask_wet(i,j)
+#  endif
+# endif
+        END DO
+      END DO
+!
+!  Grid and forcing fields.
+!
+# ifdef MASKING
+      CALL bio_coarse_mask (ng, LBi, UBi, LBj, UBj,                     &
+     &                      Nc, IstrC, IendC, JstrC, JendC,             &
+     &                      rmask, BIOGRID(tile,ng)%rmask)
+#  ifdef WET_DRY
+      CALL bio_coarse_mask (ng, LBi, UBi, LBj, UBj,                     &
+     &                      Nc, IstrC, IendC, JstrC, JendC,             &
+     &                      rmask_wet, BIOGRID(tile,ng)%rmask_wet)
+#   ifdef DIAGNOSTICS_BIO
+      CALL bio_coarse_mask (ng, LBi, UBi, LBj, UBj,                     &
+     &                      Nc, IstrC, IendC, JstrC, JendC,             &
+     &                      rmask_full, BIOGRID(tile,ng)%rmask_full)
+#   endif
+#  endif
+# endif
+      CALL bio_coarse_r3d (ng, LBi, UBi, LBj, UBj, 1, UBk,              &
+     &                     Nc, IstrC, IendC, JstrC, JendC,              &
+     &                     W, Hz, BIOGRID(tile,ng)%Hz)
+      CALL bio_coarse_r3d (ng, LBi, UBi, LBj, UBj, 1, UBk,              &
+     &                     Nc, IstrC, IendC, JstrC, JendC,              &
+     &                     W, z_r, BIOGRID(tile,ng)%z_r)
+      CALL bio_coarse_r3d (ng, LBi, UBi, LBj, UBj, 0, UBk,              &
+     &                     Nc, IstrC, IendC, JstrC, JendC,              &
+     &                     W, z_w, BIOGRID(tile,ng)%z_w)
+      CALL bio_coarse_r2d (ng, LBi, UBi, LBj, UBj,                      &
+     &                     Nc, IstrC, IendC, JstrC, JendC,              &
+     &                     W, srflx, BIOGRID(tile,ng)%srflx)
+# if defined CARBON || defined OXYGEN
+#  ifdef BULK_FLUXES
+      CALL bio_coarse_r2d (ng, LBi, UBi, LBj, UBj,                      &
+     &                     Nc, IstrC, IendC, JstrC, JendC,              &
+     &                     W, Uwind, BIOGRID(tile,ng)%Uwind)
+      CALL bio_coarse_r2d (ng, LBi, UBi, LBj, UBj,                      &
+     &                     Nc, IstrC, IendC, JstrC, JendC,              &
+     &                     W, Vwind, BIOGRID(tile,ng)%Vwind)
+#  else
+      CALL bio_coarse_u2d (ng, LBi, UBi, LBj, UBj,                      &
+     &                     Nc, IstrC, IendC, JstrC, JendC,              &
+     &                     sustr, BIOGRID(tile,ng)%sustr)
+      CALL bio_coarse_v2d (ng, LBi, UBi, LBj, UBj,                      &
+     &                     Nc, IstrC, IendC, JstrC, JendC,              &
+     &                     svstr, BIOGRID(tile,ng)%svstr)
+#  endif
+# endif
+# ifdef CARBON
+!
+!  The coarse pH, kept from the previous time-step, is the first guess
+!  of the carbonate solver.  Save it to compute its change.
+!
+      BIOGRID(tile,ng)%pH_old=BIOGRID(tile,ng)%pH
+# endif
+# ifdef DIAGNOSTICS_BIO
+!
+!  The coarse diagnostic terms start from zero, so they only hold the
+!  contributions of this time-step.
+!
+      BIOGRID(tile,ng)%DiaBio2d=0.0_r8
+      BIOGRID(tile,ng)%DiaBio3d=0.0_r8
+# endif
+!
+!  Tracers: volume-weighted averages of temperature, salinity, and
+!  biological concentrations at time index "nstp".  The biological
+!  increments are accumulated in the coarse time index 2, which starts
+!  from zero.
+!
+      BIOGRID(tile,ng)%t=0.0_r8
+      CALL bio_coarse_r3d (ng, LBi, UBi, LBj, UBj, 1, UBk,              &
+     &                     Nc, IstrC, IendC, JstrC, JendC,              &
+     &                     W, t(:,:,:,nstp,itemp),                      &
+     &                     BIOGRID(tile,ng)%t(:,:,:,1,itemp), Hz)
+      CALL bio_coarse_r3d (ng, LBi, UBi, LBj, UBj, 1, UBk,              &
+     &                     Nc, IstrC, IendC, JstrC, JendC,              &
+     &                     W, t(:,:,:,nstp,isalt),                      &
+     &                     BIOGRID(tile,ng)%t(:,:,:,1,isalt), Hz)
+      DO itrc=1,NBT
+        ibio=idbio(itrc)
+        CALL bio_coarse_r3d (ng, LBi, UBi, LBj, UBj, 1, UBk,            &
+     &                       Nc, IstrC, IendC, JstrC, JendC,            &
+     &                       W, t(:,:,:,nstp,ibio),                     &
+     &                       BIOGRID(tile,ng)%t(:,:,:,1,ibio), Hz)
+      END DO
+!
+!-----------------------------------------------------------------------
+!  Compute biological source/sink terms on the coarse grid.
+!-----------------------------------------------------------------------
+!
+      CALL biology_tile (ng, tile,                                      &
+     &                   IstrC-1, IendC+1, JstrC-1, JendC+1, UBk, UBt,  &
+     &                   IstrC-1, IendC+1, JstrC-1, JendC+1,            &
+     &                   IstrC, IendC, JstrC, JendC,                    &
+     &                   1, 2,                                          &
+# ifdef MASKING
+     &                   BIOGRID(tile,ng)%rmask,                        &
+#  ifdef WET_DRY
+     &                   BIOGRID(tile,ng)%rmask_wet,                    &
+#   ifdef DIAGNOSTICS_BIO
+     &                   BIOGRID(tile,ng)%rmask_full,                   &
+#   endif
+#  endif
+# endif
+     &                   BIOGRID(tile,ng)%Hz,                           &
+     &                   BIOGRID(tile,ng)%z_r,                          &
+     &                   BIOGRID(tile,ng)%z_w,                          &
+     &                   BIOGRID(tile,ng)%srflx,                        &
+# if defined CARBON || defined OXYGEN
+#  ifdef BULK_FLUXES
+     &                   BIOGRID(tile,ng)%Uwind,                        &
+     &                   BIOGRID(tile,ng)%Vwind,                        &
+#  else
+     &                   BIOGRID(tile,ng)%sustr,                        &
+     &                   BIOGRID(tile,ng)%svstr,                        &
+#  endif
+# endif
+# ifdef CARBON
+     &                   BIOGRID(tile,ng)%pH,                           &
+# endif
+# ifdef DIAGNOSTICS_BIO
+     &                   BIOGRID(tile,ng)%DiaBio2d,                     &
+     &                   BIOGRID(tile,ng)%DiaBio3d,                     &
+# endif
+     &                   BIOGRID(tile,ng)%t)
+!
+!-----------------------------------------------------------------------
+!  Distribute coarse increments back to the tile interior points.
+!-----------------------------------------------------------------------
+!
+!  The coarse increments have transport units (m Tunits), convert them
+!  to concentration and multiply by the thickness of each wet point.
+!
+      DO jc=JstrC,JendC
+        DO ic=IstrC,IendC
+          CALL bio_coarse_block (ng, Nc, ic, jc,                        &
+     &                           Imin, Imax, Jmin, Jmax)
+          DO itrc=1,NBT
+            ibio=idbio(itrc)
+            DO k=1,UBk
+              cff=BIOGRID(tile,ng)%t(ic,jc,k,2,ibio)/                   &
+     &            BIOGRID(tile,ng)%Hz(ic,jc,k)
+              DO j=MAX(Jmin,Jstr),MIN(Jmax,Jend)
+                DO i=MAX(Imin,Istr),MIN(Imax,Iend)
+                  cff1=cff*Hz(i,j,k)
+# ifdef MASKING
+                  cff1=cff1*rmask(i,j)
+#  ifdef WET_DRY
+                  cff1=cff1*rmask_wet(i,j)
+#  endif
+# endif
+                  t(i,j,k,nnew,ibio)=t(i,j,k,nnew,ibio)+cff1
+                END DO
+              END DO
+            END DO
+          END DO
+# ifdef CARBON
+!
+!  Keep the physical grid pH and add the change of the coarse pH.
+!
+          cff=BIOGRID(tile,ng)%pH(ic,jc)-BIOGRID(tile,ng)%pH_old(ic,jc)
+          DO j=MAX(Jmin,Jstr),MIN(Jmax,Jend)
+            DO i=MAX(Imin,Istr),MIN(Imax,Iend)
+              pH(i,j)=pH(i,j)+cff
+#  ifdef MASKING
+              pH(i,j)=pH(i,j)*rmask(i,j)
+#  endif
+            END DO
+          END DO
+# endif
+        END DO
+      END DO
+# ifdef DIAGNOSTICS_BIO
+!
+!  Add the diagnostic terms of this time-step to all the points of each
+!  block.  If appropriate, initialize first the time-averaged arrays as
+!  in "biology_tile".  The instantaneous pCO2 is replaced instead.
+!
+      IF (((iic(ng).gt.ntsDIA(ng)).and.                                 &
+     &     (MOD(iic(ng),nDIA(ng)).eq.1)).or.                            &
+     &    ((iic(ng).ge.ntsDIA(ng)).and.(nDIA(ng).eq.1)).or.             &
+     &    ((nrrec(ng).gt.0).and.(iic(ng).eq.ntstart(ng)))) THEN
+        DO ivar=1,NDbio2d
+          DO j=Jstr,Jend
+            DO i=Istr,Iend
+              DiaBio2d(i,j,ivar)=0.0_r8
+            END DO
+          END DO
+        END DO
+        DO ivar=1,NDbio3d
+          DO k=1,UBk
+            DO j=Jstr,Jend
+              DO i=Istr,Iend
+                DiaBio3d(i,j,k,ivar)=0.0_r8
+              END DO
+            END DO
+          END DO
+        END DO
+      END IF
+#  ifdef CARBON
+      DO j=Jstr,Jend
+        DO i=Istr,Iend
+          DiaBio2d(i,j,ipCO2)=0.0_r8
+        END DO
+      END DO
+#  endif
+      DO ivar=1,NDbio2d
+#  ifdef WET_DRY
+        CALL bio_coarse_add2d (ng, tile, LBi, UBi, LBj, UBj,            &
+     &                         Nc, IstrC, IendC, JstrC, JendC,          &
+     &                         BIOGRID(tile,ng)%DiaBio2d(:,:,ivar),     &
+     &                         DiaBio2d(:,:,ivar), rmask_full)
+#  else
+        CALL bio_coarse_add2d (ng, tile, LBi, UBi, LBj, UBj,            &
+     &                         Nc, IstrC, IendC, JstrC, JendC,          &
+     &                         BIOGRID(tile,ng)%DiaBio2d(:,:,ivar),     &
+     &                         DiaBio2d(:,:,ivar))
+#  endif
+      END DO
+      DO ivar=1,NDbio3d
+#  ifdef WET_DRY
+        CALL bio_coarse_add3d (ng, tile, LBi, UBi, LBj, UBj, 1, UBk,    &
+     &                         Nc, IstrC, IendC, JstrC, JendC,          &
+     &                         BIOGRID(tile,ng)%DiaBio3d(:,:,:,ivar),   &
+     &                         DiaBio3d(:,:,:,ivar), rmask_full)
+#  else
+        CALL bio_coarse_add3d (ng, tile, LBi, UBi, LBj, UBj, 1, UBk,    &
+     &                         Nc, IstrC, IendC, JstrC, JendC,          &
+     &                         BIOGRID(tile,ng)%DiaBio3d(:,:,:,ivar),   &
+     &                         DiaBio3d(:,:,:,ivar))
+#  endif
+      END DO
+# endif
+
+      RETURN
+      END SUBROUTINE biology_coarse
+#endif
 !
 !-----------------------------------------------------------------------
       SUBROUTINE biology_tile (ng, tile,                                &
      &                         LBi, UBi, LBj, UBj, UBk, UBt,            &
      &                         IminS, ImaxS, JminS, JmaxS,              &
+     &                         Istr, Iend, Jstr, Jend,                  &
      &                         nstp, nnew,                              &
 #ifdef MASKING
      &                         rmask,                                   &
@@ -189,6 +643,7 @@
       integer, intent(in) :: ng, tile
       integer, intent(in) :: LBi, UBi, LBj, UBj, UBk, UBt
       integer, intent(in) :: IminS, ImaxS, JminS, JmaxS
+      integer, intent(in) :: Istr, Iend, Jstr, Jend
       integer, intent(in) :: nstp, nnew
 
 #ifdef ASSUMED_SHAPE
@@ -375,7 +830,6 @@
       real(r8), dimension(IminS:ImaxS,N(ng)) :: bR
       real(r8), dimension(IminS:ImaxS,N(ng)) :: qc
 
-#include "set_bounds.h"
 #ifdef DIAGNOSTICS_BIO
 !
 !-----------------------------------------------------------------------
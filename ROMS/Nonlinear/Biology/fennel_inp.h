@@ -30,7 +30,7 @@
 !
 !  Local variable declarations.
 !
-      integer :: Npts, Nval
+      integer :: Npts, Nval, io
       integer :: iTrcStr, iTrcEnd
       integer :: i, ifield, igrid, itracer, itrc, ng, nline, status
 
@@ -60,12 +60,18 @@
 !-----------------------------------------------------------------------
 !
       DO WHILE (.TRUE.)
-        READ (inp,'(a)',ERR=10,END=20) line
+        CALL inp_read (inp, line, io)
+        IF (io.gt.0) GO TO 10
+        IF (io.lt.0) GO TO 20
         status=decode_line(line, KeyWord, Nval, Cval, Rval)
         IF (status.gt.0) THEN
           SELECT CASE (TRIM(KeyWord))
             CASE ('Lbiology')
               Npts=load_l(Nval, Cval, Ngrids, Lbiology)
+#ifdef BIO_COARSE
+            CASE ('BioCoarse')
+              Npts=load_i(Nval, Rval, Ngrids, BioCoarse)
+#endif
             CASE ('BioIter')
               Npts=load_i(Nval, Rval, Ngrids, BioIter)
             CASE ('AttSW')
@@ -573,6 +579,25 @@
       exit_flag=4
       RETURN
   20  CONTINUE
+#ifdef BIO_COARSE
+!
+!  Check coarsening factor of the biology grid.  In distributed-memory
+!  the coarse blocks straddling the tile boundaries are averaged from
+!  the halo points, which limits the factor to the number of
+!  ghost-points.
+!
+      DO ng=1,Ngrids
+# ifdef DISTRIBUTE
+        IF ((BioCoarse(ng).lt.1).or.(BioCoarse(ng).gt.3)) THEN
+# else
+        IF (BioCoarse(ng).lt.1) THEN
+# endif
+          IF (Master) WRITE (out,140) 'BioCoarse', ng, BioCoarse(ng)
+          exit_flag=5
+          RETURN
+        END IF
+      END DO
+#endif
 !
 !-----------------------------------------------------------------------
 !  Report input parameters.
@@ -584,6 +609,10 @@
             WRITE (out,60) ng
             WRITE (out,70) BioIter(ng), 'BioIter',                      &
      &            'Number of iterations for nonlinear convergence.'
+#ifdef BIO_COARSE
+            WRITE (out,70) BioCoarse(ng), 'BioCoarse',                  &
+     &            'Coarsening factor of the biology grid.'
+#endif
             WRITE (out,80) AttSW(ng), 'AttSW',                          &
      &            'Light attenuation of seawater (m-1).'
             WRITE (out,80) AttChl(ng), 'AttChl',                        &
@@ -999,6 +1028,10 @@
  110  FORMAT (10x,l1,2x,a,'(',i2.2,')',t32,a,i2.2,':',1x,a)
  120  FORMAT (10x,l1,2x,a,t32,a,i2.2,':',1x,a)
  130  FORMAT (10x,l1,2x,a,t32,a,1x,a)
+#ifdef BIO_COARSE
+ 140  FORMAT (/,' read_BioPar - Invalid value for ',a,' in grid ',      &
+     &        i2.2,':',1x,i0)
+#endif
 
       RETURN
       END SUBROUTINE read_BioPar
@@ -11,6 +11,10 @@
 !                                                                      !
 !   AttSW    Light attenuation due to sea water [1/m].                 !
 !   AttChl   Light attenuation by Chlorophyll [1/(mg_Chl m2)].         !
+!   BioCoarse Horizontal coarsening factor of the biology grid, the    !
+!              source/sink terms are computed on blocks of             !
+!              BioCoarse x BioCoarse points (BIO_COARSE option).       !
+!   BIOGRID  Coarse biology grid arrays for each tile and grid.        !
 !   BioIter  Maximum number of iterations to achieve convergence       !
 !              of the nonlinear solution.                              !
 !   Chl2C_m  Maximum chlorophyll to carbon ratio [mg_Chl/mg_C].        !
@@ -106,6 +110,9 @@
 !
 !  Biological parameters.
 !
+#ifdef BIO_COARSE
+      integer, allocatable :: BioCoarse(:)
+#endif
       integer, allocatable :: BioIter(:)
 
       real(r8), allocatable :: AttSW(:)              ! 1/m
@@ -144,6 +151,53 @@
       real(r8), allocatable :: ZooMR(:)              ! 1/day
       real(r8), allocatable :: pCO2air(:)            ! ppmv
 
+#ifdef BIO_COARSE
+!
+!  Coarse biology grid arrays for each tile, dimensioned over the
+!  blocks IstrC:IendC and JstrC:JendC that overlap the tile plus one
+!  halo point.  They are allocated once by "allocate_biogrid".  The
+!  coarse tracers hold the averaged state in time index 1 and the
+!  biological increment in time index 2.  The coarse pH is kept
+!  between time-steps as the first guess of the carbonate solver.
+!
+      TYPE T_BIOGRID
+        integer :: IstrC, IendC, JstrC, JendC
+# ifdef MASKING
+        real(r8), allocatable :: rmask(:,:)
+#  ifdef WET_DRY
+        real(r8), allocatable :: rmask_wet(:,:)
+#   ifdef DIAGNOSTICS_BIO
+        real(r8), allocatable :: rmask_full(:,:)
+#   endif
+#  endif
+# endif
+        real(r8), allocatable :: Hz(:,:,:)
+        real(r8), allocatable :: z_r(:,:,:)
+        real(r8), allocatable :: z_w(:,:,:)
+        real(r8), allocatable :: srflx(:,:)
+# if defined CARBON || defined OXYGEN
+#  ifdef BULK_FLUXES
+        real(r8), allocatable :: Uwind(:,:)
+        real(r8), allocatable :: Vwind(:,:)
+#  else
+        real(r8), allocatable :: sustr(:,:)
+        real(r8), allocatable :: svstr(:,:)
+#  endif
+# endif
+# ifdef CARBON
+        real(r8), allocatable :: pH(:,:)
+        real(r8), allocatable :: pH_old(:,:)
+# endif
+# ifdef DIAGNOSTICS_BIO
+        real(r8), allocatable :: DiaBio2d(:,:,:)
+        real(r8), allocatable :: DiaBio3d(:,:,:,:)
+# endif
+        real(r8), allocatable :: t(:,:,:,:,:)
+      END TYPE T_BIOGRID
+
+      TYPE (T_BIOGRID), allocatable :: BIOGRID(:,:)
+#endif
+
       CONTAINS
 
       SUBROUTINE initialize_biology
@@ -218,6 +272,18 @@
 !  Allocate various module variables.
 !-----------------------------------------------------------------------
 !
+#ifdef BIO_COARSE
+      IF (.not.allocated(BioCoarse)) THEN
+        allocate ( BioCoarse(Ngrids) )
+        Dmem(1)=Dmem(1)+REAL(Ngrids,r8)
+        BioCoarse=1
+      END IF
+
+      IF (.not.allocated(BIOGRID)) THEN
+        allocate ( BIOGRID(0:MAXVAL(NtileI*NtileJ)-1,Ngrids) )
+      END IF
+
+#endif
       IF (.not.allocated(BioIter)) THEN
         allocate ( BioIter(Ngrids) )
         Dmem(1)=Dmem(1)+REAL(Ngrids,r8)
@@ -450,3 +516,74 @@
 
       RETURN
       END SUBROUTINE initialize_biology
+#ifdef BIO_COARSE
+
+      SUBROUTINE allocate_biogrid (ng, tile, IstrC, IendC, JstrC, JendC)
+!
+!=======================================================================
+!                                                                      !
+!  This routine allocates the coarse biology grid arrays of the given  !
+!  tile on its first call.                                             !
+!                                                                      !
+!=======================================================================
+!
+!  Imported variable declarations.
+!
+      integer, intent(in) :: ng, tile
+      integer, intent(in) :: IstrC, IendC, JstrC, JendC
+!
+!  Local variable declarations.
+!
+      integer :: LBc, UBc, LBe, UBe
+!
+!-----------------------------------------------------------------------
+!  Allocate coarse arrays.
+!-----------------------------------------------------------------------
+!
+      BIOGRID(tile,ng)%IstrC=IstrC
+      BIOGRID(tile,ng)%IendC=IendC
+      BIOGRID(tile,ng)%JstrC=JstrC
+      BIOGRID(tile,ng)%JendC=JendC
+
+      LBc=IstrC-1
+      UBc=IendC+1
+      LBe=JstrC-1
+      UBe=JendC+1
+
+# ifdef MASKING
+      allocate ( BIOGRID(tile,ng)%rmask(LBc:UBc,LBe:UBe) )
+#  ifdef WET_DRY
+      allocate ( BIOGRID(tile,ng)%rmask_wet(LBc:UBc,LBe:UBe) )
+#   ifdef DIAGNOSTICS_BIO
+      allocate ( BIOGRID(tile,ng)%rmask_full(LBc:UBc,LBe:UBe) )
+#   endif
+#  endif
+# endif
+      allocate ( BIOGRID(tile,ng)%Hz(LBc:UBc,LBe:UBe,N(ng)) )
+      allocate ( BIOGRID(tile,ng)%z_r(LBc:UBc,LBe:UBe,N(ng)) )
+      allocate ( BIOGRID(tile,ng)%z_w(LBc:UBc,LBe:UBe,0:N(ng)) )
+      allocate ( BIOGRID(tile,ng)%srflx(LBc:UBc,LBe:UBe) )
+# if defined CARBON || defined OXYGEN
+#  ifdef BULK_FLUXES
+      allocate ( BIOGRID(tile,ng)%Uwind(LBc:UBc,LBe:UBe) )
+      allocate ( BIOGRID(tile,ng)%Vwind(LBc:UBc,LBe:UBe) )
+#  else
+      allocate ( BIOGRID(tile,ng)%sustr(LBc:UBc,LBe:UBe) )
+      allocate ( BIOGRID(tile,ng)%svstr(LBc:UBc,LBe:UBe) )
+#  endif
+# endif
+# ifdef CARBON
+      allocate ( BIOGRID(tile,ng)%pH(LBc:UBc,LBe:UBe) )
+      BIOGRID(tile,ng)%pH=8.0_r8
+      allocate ( BIOGRID(tile,ng)%pH_old(LBc:UBc,LBe:UBe) )
+# endif
+# ifdef DIAGNOSTICS_BIO
+      allocate ( BIOGRID(tile,ng)%DiaBio2d(LBc:UBc,LBe:UBe,NDbio2d) )
+      allocate ( BIOGRID(tile,ng)%DiaBio3d(LBc:UBc,LBe:UBe,N(ng),       &
+     &                                     NDbio3d) )
+# endif
+      allocate ( BIOGRID(tile,ng)%t(LBc:UBc,LBe:UBe,N(ng),3,NT(ng)) )
+
+      RETURN
+      END SUBROUTINE allocate_biogrid
+#endif
@@ -30,7 +30,7 @@
 !
 !  Local variable declarations.
 !
-      integer :: Npts, Nval
+      integer :: Npts, Nval, io
       integer :: iTrcStr, iTrcEnd
       integer :: i, ifield, igrid, itracer, itrc, ng, nline, status
 
@@ -62,7 +62,9 @@
       IF (.not.allocated(BioIni)) allocate ( BioIni(MT,Ngrids) )
 #endif
       DO WHILE (.TRUE.)
-        READ (inp,'(a)',ERR=10,END=20) line
+        CALL inp_read (inp, line, io)
+        IF (io.gt.0) GO TO 10
+        IF (io.lt.0) GO TO 20
         status=decode_line(line, KeyWord, Nval, Cval, Rval)
         IF (status.gt.0) THEN
           SELECT CASE (TRIM(KeyWord))
@@ -39,6 +39,11 @@
 !  SR: larval sinking rate (mm/s)                                      !
 !  DS: salinity change rate (1/s)                                      !
 !                                                                      !
+!  The active floats are gathered into compacted work arrays, so the   !
+!  growth and swimming behavior is computed in simple loops over       !
+!  contiguous vectors that the compiler can vectorize.  The settled    !
+!  larvae are compacted into a separate list and processed last.       !
+!                                                                      !
 !  References:                                                         !
 !                                                                      !
 !    Dekshenieks, M.M., E.E. Hofmann, and E.N. Powell, 1993:           !
@@ -140,22 +145,27 @@
 !
 !  Local variable declarations.
 !
-      integer :: i, i1, i2, j1, j2, l
+      integer :: Nact, Nset, i, i1, i2, j1, j2, l, ip
+
+      integer, dimension(Lend-Lstr+1) :: Lact, Lset
+
+      logical, dimension(Lend-Lstr+1) :: Lnew
 
-      real(r8) :: dsalt, temp, salt
-      real(r8) :: Lfood, Lturb, Lsize, LsizeNew
-      real(r8) :: Grate, Gfactor, turb_ef
-      real(r8) :: SwimRate, SwimTime, SwimTimeNew
-      real(r8) :: bottom, brhs, sink, w_bio
-      real(r8) :: cff1, cff2, cff3, cff4
+      real(r8) :: Lfood, Lturb, turb_ef
+      real(r8) :: bottom, cff1, cff2, cff3, cff4
       real(r8) :: p1, p2, q1, q2
       real(r8) :: my_food, my_salt, my_size, my_temp
       real(r8) :: oGfactor_DS, oGfactor_DT
       real(r8) :: oGrate_DF, oGrate_DL
       real(r8) :: oswim_DL, oswim_DT
       real(r8) :: HalfDT
+
+      real(r8), dimension(Lend-Lstr+1) :: dsalt, temp, salt
+      real(r8), dimension(Lend-Lstr+1) :: Lsize, Grate, Gfactor, brhs
+      real(r8), dimension(Lend-Lstr+1) :: SwimRate, SwimTime
+      real(r8), dimension(Lend-Lstr+1) :: SwimTimeNew, sink, w_bio
 !
-!-----------------------------------------------------4-----------------
+!-----------------------------------------------------------------------
 !  Estimate larval growth, as length (um), based on food, salinity,
 !  temperature and turbidity.  Then, estimate swimming time (s),
 !  larvae sinking velocity (m/s) and larvae vertical velocity (m/s).
@@ -185,65 +195,83 @@
         cff4=6.0_r8/8.0_r8
       END IF
 !
-!  Compute biological behavior fields.
+!  For now, assume constant food and turbidity.  This can be changed in
+!  the future with spatial and temporal variability for food and/or
+!  turbidity.  If this is the case, we need to gather them like the
+!  temperature and salinity below:
 !
-      HalfDT=0.5_r8*dt(ng)
+!         IF (Predictor) THEN
+!           Lfood(ip)=track(ifood,nf,l)
+!           Lturb(ip)=track(iturb,nf,l)
+!           ...
+!         ELSE
+!           Lfood(ip)=track(ifood,nfp1,l)
+!           Lturb(ip)=track(iturb,nfp1,l)
+!           ...
+!         END IF
+!
+!  The food variability may be from data, ecosystem model, or analytical
+!  functions. Similarly, the turbidity may be from data, sediment model,
+!  or analytical functions.
+!
+      Lfood=food_supply(ng)
+      Lturb=turb_ambi(ng)
 
+      HalfDT=0.5_r8*dt(ng)
+!
+!-----------------------------------------------------------------------
+!  Gather active floats into compacted work arrays.
+!-----------------------------------------------------------------------
+!
+      Nact=0
       DO l=Lstr,Lend
         IF (my_thread(l).and.bounded(l)) THEN
+          Nact=Nact+1
+          Lact(Nact)=l
+          Lnew(Nact)=time(ng)-HalfDT.le.Tinfo(itstr,l).and.             &
+     &               time(ng)+HalfDT.gt.Tinfo(itstr,l)
+        END IF
+      END DO
 !
 !  If newly relased float, initialize biological behavior fields. Note
 !  that since we need temperature and salinity, we need to initialize
 !  their values to all time levels. Otherwise, we will have a parallel
 !  bug.
 !
-          IF (time(ng)-HalfDT.le.Tinfo(itstr,l).and.                    &
-     &        time(ng)+HalfDT.gt.Tinfo(itstr,l)) THEN
-            temp=track(ifTvar(itemp),nfp1,l)
-            salt=track(ifTvar(isalt),nfp1,l)
-            DO i=0,NFT
-              track(isizf,i,l)=Larvae_size0(ng)
-              track(iswim,i,l)=0.5_r8*(swim_Tmin(ng)+swim_Tmax(ng))
-              track(ifTvar(itemp),i,l)=temp
-              track(ifTvar(isalt),i,l)=salt
-            END DO
-          END IF
-!
-!  Get temperature, salinity, larvae size (length), swimming time, and
-!  food supply. For now, assume constant food and turbidity.  This
-!  can be changed in the future with spatial and temporal variability
-!  for food and/or turbidity.  If this is the case, we need to have
-!  something like:
+      DO ip=1,Nact
+        IF (Lnew(ip)) THEN
+          l=Lact(ip)
+          temp(ip)=track(ifTvar(itemp),nfp1,l)
+          salt(ip)=track(ifTvar(isalt),nfp1,l)
+          DO i=0,NFT
+            track(isizf,i,l)=Larvae_size0(ng)
+            track(iswim,i,l)=0.5_r8*(swim_Tmin(ng)+swim_Tmax(ng))
+            track(ifTvar(itemp),i,l)=temp(ip)
+            track(ifTvar(isalt),i,l)=salt(ip)
+          END DO
+        END IF
+      END DO
 !
-!         IF (Predictor) THEN
-!           Lfood=track(ifood,nf,l)
-!           Lturb=track(iturb,nf,l)
-!           ...
-!         ELSE
-!           Lfood=track(ifood,nfp1,l)
-!           Lturb=track(iturb,nfp1,l)
-!           ...
-!         END IF
+!  Get temperature, salinity, larvae size (length), and swimming time.
 !
-!  The food variability may be from data, ecosystem model, or analytical
-!  functions. Similarly, the turbidity may be from data, sediment model,
-!  or analytical functions.
+      IF (Predictor) THEN
+        i=nf
+      ELSE
+        i=nfp1
+      END IF
+      DO ip=1,Nact
+        l=Lact(ip)
+        temp(ip)=track(ifTvar(itemp),nfp1,l)
+        salt(ip)=track(ifTvar(isalt),nfp1,l)
+        dsalt(ip)=track(ifTvar(isalt),nfp1,l)-                          &
+     &           track(ifTvar(isalt),nf  ,l)
+        Lsize(ip)=track(isizf,i,l)
+        SwimTime(ip)=track(iswim,i,l)
+      END DO
 !
-          temp=track(ifTvar(itemp),nfp1,l)
-          salt=track(ifTvar(isalt),nfp1,l)
-          dsalt=track(ifTvar(isalt),nfp1,l)-                            &
-     &          track(ifTvar(isalt),nf  ,l)
-          IF (Predictor) THEN
-            Lsize=track(isizf,nf,l)
-            SwimTime=track(iswim,nf,l)
-            Lfood=food_supply(ng)
-            Lturb=turb_ambi(ng)
-          ELSE
-            Lsize=track(isizf,nfp1,l)
-            SwimTime=track(iswim,nfp1,l)
-            Lfood=food_supply(ng)
-            Lturb=turb_ambi(ng)
-          END IF
+!-----------------------------------------------------------------------
+!  Larval growth.
+!-----------------------------------------------------------------------
 !
 !  Determine larval growth rate (um/day) contribution as function of
 !  food supply (mg_Carbon/l) and larval size (um). Linearly interpolate
@@ -251,189 +279,221 @@
 !  size. Notice that extrapolation is suppresed by bounding "Lfood" and
 !  "Lsize" to the range values in the look table.
 !
-          my_food=MIN(MAX(Grate_F0,Lfood),                              &
-     &                Grate_F0+Grate_DF*REAL(Grate_Im-1,r8))
-          my_size=MIN(MAX(Grate_L0,Lsize),                              &
-     &                Grate_L0+Grate_DL*REAL(Grate_Jm-1,r8))
-
-          i1=INT(1.0_r8+(my_food-Grate_F0)*oGrate_DF)
-          i2=MIN(i1+1,Grate_Im)
-          j1=INT(1.0_r8+(my_size-Grate_L0)*oGrate_DL)
-          j2=MIN(j1+1,Grate_Jm)
+      my_food=MIN(MAX(Grate_F0,Lfood),                                  &
+     &            Grate_F0+Grate_DF*REAL(Grate_Im-1,r8))
+      i1=INT(1.0_r8+(my_food-Grate_F0)*oGrate_DF)
+      i2=MIN(i1+1,Grate_Im)
+      p2=(my_food-(Grate_F0+REAL(i1-1,r8)*Grate_DF))*oGrate_DF
+      p1=1.0_r8-p2
 
-          p2=(my_food-(Grate_F0+REAL(i1-1,r8)*Grate_DF))*oGrate_DF
-          q2=(my_size-(Grate_L0+REAL(j1-1,r8)*Grate_DL))*oGrate_DL
-          p1=1.0_r8-p2
-          q1=1.0_r8-q2
+      DO ip=1,Nact
+        my_size=MIN(MAX(Grate_L0,Lsize(ip)),                            &
+     &              Grate_L0+Grate_DL*REAL(Grate_Jm-1,r8))
+        j1=INT(1.0_r8+(my_size-Grate_L0)*oGrate_DL)
+        j2=MIN(j1+1,Grate_Jm)
+        q2=(my_size-(Grate_L0+REAL(j1-1,r8)*Grate_DL))*oGrate_DL
+        q1=1.0_r8-q2
 
-          Grate=p1*q1*Grate_table(i1,j1)+                               &
-     &          p2*q1*Grate_table(i2,j1)+                               &
-     &          p1*q2*Grate_table(i1,j2)+                               &
-     &          p2*q2*Grate_table(i2,j2)
+        Grate(ip)=p1*q1*Grate_table(i1,j1)+                             &
+     &           p2*q1*Grate_table(i2,j1)+                              &
+     &           p1*q2*Grate_table(i1,j2)+                              &
+     &           p2*q2*Grate_table(i2,j2)
+      END DO
 !
 !  Determine larval growth rate factor (nondimensional) as function of
 !  salinity and temperature (Celsius). Linearly interpolate growth rate
 !  factor from the look table of salinity versus temperature. Notice
 !  that extrapolation is suppresed by bounding "salt" and "temp" to the
-!  range values in the look table.
-!
-          IF (temp.lt.Gfactor_T0) THEN
-            Gfactor=0.0_r8
-          ELSE
-            my_salt=MIN(MAX(Gfactor_S0,salt),                           &
-     &                  Gfactor_S0+Gfactor_DS*REAL(Gfactor_Im-1,r8))
-            my_temp=MIN(MAX(Gfactor_T0,temp),                           &
-     &                  Gfactor_T0+Gfactor_DT*REAL(Gfactor_Jm-1,r8))
+!  range values in the look table.  The growth factor is masked to zero
+!  below the minimum temperature.
+!
+      DO ip=1,Nact
+        my_salt=MIN(MAX(Gfactor_S0,salt(ip)),                           &
+     &              Gfactor_S0+Gfactor_DS*REAL(Gfactor_Im-1,r8))
+        my_temp=MIN(MAX(Gfactor_T0,temp(ip)),                           &
+     &              Gfactor_T0+Gfactor_DT*REAL(Gfactor_Jm-1,r8))
 
-            i1=INT(1.0_r8+(my_salt-Gfactor_S0)*oGfactor_DS)
-            i2=MIN(i1+1,Gfactor_Im)
-            j1=INT(1.0_r8+(my_temp-Gfactor_T0)*oGfactor_DT)
-            j2=MIN(j1+1,Gfactor_Jm)
+        i1=INT(1.0_r8+(my_salt-Gfactor_S0)*oGfactor_DS)
+        i2=MIN(i1+1,Gfactor_Im)
+        j1=INT(1.0_r8+(my_temp-Gfactor_T0)*oGfactor_DT)
+        j2=MIN(j1+1,Gfactor_Jm)
 
-            p2=(my_salt-(Gfactor_S0+REAL(i1-1,r8)*Gfactor_DS))*         &
-     &         oGfactor_DS
-            q2=(my_temp-(Gfactor_T0+REAL(j1-1,r8)*Gfactor_DT))*         &
-     &         oGfactor_DT
-            p1=1.0_r8-p2
-            q1=1.0_r8-q2
+        p2=(my_salt-(Gfactor_S0+REAL(i1-1,r8)*Gfactor_DS))*oGfactor_DS
+        q2=(my_temp-(Gfactor_T0+REAL(j1-1,r8)*Gfactor_DT))*oGfactor_DT
+        p1=1.0_r8-p2
+        q1=1.0_r8-q2
 
-            Gfactor=p1*q1*Gfactor_table(i1,j1)+                         &
-     &              p2*q1*Gfactor_table(i2,j1)+                         &
-     &              p1*q2*Gfactor_table(i1,j2)+                         &
-     &              p2*q2*Gfactor_table(i2,j2)
-          END IF
+        Gfactor(ip)=p1*q1*Gfactor_table(i1,j1)+                         &
+     &             p2*q1*Gfactor_table(i2,j1)+                          &
+     &             p1*q2*Gfactor_table(i1,j2)+                          &
+     &             p2*q2*Gfactor_table(i2,j2)
+        IF (temp(ip).lt.Gfactor_T0) Gfactor(ip)=0.0_r8
+      END DO
 !
 !  Determine turbidity effect (linear or exponential) on larval growth.
 !  Then, compute new larvae size (um) as function of growth rate (um/s)
 !  which is loaded in track(ibrhs,:,:).
 !
-          IF (Lsize.gt.turb_size(ng)) THEN
-            IF (Lturb.gt.turb_crit(ng)) THEN
-              turb_ef=turb_base(ng)*                                    &
-     &                EXP(-turb_rate(ng)*(Lturb-turb_mean(ng)))
-            ELSE
-              turb_ef=turb_slop(ng)*Lturb+turb_axis(ng)
-            END IF
-            track(ibrhs,nfp1,l)=Grate*Gfactor*turb_ef*sec2day
-          ELSE
-            track(ibrhs,nfp1,l)=Larvae_GR0(ng)*Gfactor*sec2day
-          END IF
-          IF (Predictor) THEN
-            track(isizf,nfp1,l)=track(isizf,nfm3,l)+                    &
-     &                          dt(ng)*(cff1*track(ibrhs,nf  ,l)-       &
-     &                                  cff2*track(ibrhs,nfm1,l)+       &
-     &                                  cff1*track(ibrhs,nfm2,l))
-          ELSE
-            track(isizf,nfp1,l)=cff1*track(isizf,nf  ,l)-               &
-     &                          cff2*track(isizf,nfm2,l)+               &
-     &                          dt(ng)*(cff3*track(ibrhs,nfp1,l)+       &
-     &                                  cff4*track(ibrhs,nf  ,l)-       &
-     &                                  cff3*track(ibrhs,nfm1,l))
-          END IF
-          Lsize=track(isizf,nfp1,l)
+      IF (Lturb.gt.turb_crit(ng)) THEN
+        turb_ef=turb_base(ng)*                                          &
+     &          EXP(-turb_rate(ng)*(Lturb-turb_mean(ng)))
+      ELSE
+        turb_ef=turb_slop(ng)*Lturb+turb_axis(ng)
+      END IF
+
+      DO ip=1,Nact
+        IF (Lsize(ip).gt.turb_size(ng)) THEN
+          brhs(ip)=Grate(ip)*Gfactor(ip)*turb_ef*sec2day
+        ELSE
+          brhs(ip)=Larvae_GR0(ng)*Gfactor(ip)*sec2day
+        END IF
+      END DO
+
+      IF (Predictor) THEN
+        DO ip=1,Nact
+          l=Lact(ip)
+          track(ibrhs,nfp1,l)=brhs(ip)
+          track(isizf,nfp1,l)=track(isizf,nfm3,l)+                      &
+     &                        dt(ng)*(cff1*track(ibrhs,nf  ,l)-         &
+     &                                cff2*track(ibrhs,nfm1,l)+         &
+     &                                cff1*track(ibrhs,nfm2,l))
+          Lsize(ip)=track(isizf,nfp1,l)
+        END DO
+      ELSE
+        DO ip=1,Nact
+          l=Lact(ip)
+          track(ibrhs,nfp1,l)=brhs(ip)
+          track(isizf,nfp1,l)=cff1*track(isizf,nf  ,l)-                 &
+     &                        cff2*track(isizf,nfm2,l)+                 &
+     &                        dt(ng)*(cff3*track(ibrhs,nfp1,l)+         &
+     &                                cff4*track(ibrhs,nf  ,l)-         &
+     &                                cff3*track(ibrhs,nfm1,l))
+          Lsize(ip)=track(isizf,nfp1,l)
+        END DO
+      END IF
+!
+!-----------------------------------------------------------------------
+!  Larval vertical migration.
+!-----------------------------------------------------------------------
 !
 !  Estimate the fraction of time that the larvae spend swimming.
 !
-          IF (ABS(dsalt).lt.0.00001_r8) THEN
-            dsalt=0.0_r8
-          END IF
-          IF (dsalt.gt.0.0_r8) THEN
-            SwimTimeNew=MIN(SwimTime+dsalt*slope_Sinc(ng),swim_Tmax(ng))
-          ELSE
-            SwimTimeNew=MAX(SwimTime+dsalt*slope_Sdec(ng),swim_Tmin(ng))
-          END IF
+      DO ip=1,Nact
+        IF (ABS(dsalt(ip)).lt.0.00001_r8) THEN
+          dsalt(ip)=0.0_r8
+        END IF
+        IF (dsalt(ip).gt.0.0_r8) THEN
+          SwimTimeNew(ip)=MIN(SwimTime(ip)+dsalt(ip)*slope_Sinc(ng),    &
+     &                       swim_Tmax(ng))
+        ELSE
+          SwimTimeNew(ip)=MAX(SwimTime(ip)+dsalt(ip)*slope_Sdec(ng),    &
+     &                       swim_Tmin(ng))
+        END IF
+      END DO
 !
 !  Compute swim behavior as function of larval size and temperature.
 !  Linearly interpolate swimming rate (mm/s) from the look table of
 !  larval size (um) versus temperature (Celsius).  Notice that
 !  extrapolation is suppresed by bounding "Lsize" and "temp" to
-!  the range values in the look table.
-!
-          IF ((temp.lt.swim_T0).or.(Lsize.lt.swim_L0)) THEN
-            SwimRate=0.0_r8
-          ELSE
-            my_size=MIN(MAX(swim_L0,Lsize),                             &
-     &                  swim_L0+swim_DL*REAL(swim_Im-1,r8))
-            my_temp=MIN(MAX(swim_T0,temp),                              &
-     &                  swim_T0+swim_DT*REAL(swim_Jm-1,r8))
+!  the range values in the look table.  The swimming rate is masked
+!  to zero for small larvae or below the minimum temperature.
+!
+      DO ip=1,Nact
+        my_size=MIN(MAX(swim_L0,Lsize(ip)),                             &
+     &              swim_L0+swim_DL*REAL(swim_Im-1,r8))
+        my_temp=MIN(MAX(swim_T0,temp(ip)),                              &
+     &              swim_T0+swim_DT*REAL(swim_Jm-1,r8))
 
-            i1=INT(1.0_r8+(my_size-swim_L0)*oswim_DL)
-            i2=MIN(i1+1,swim_Im)
-            j1=INT(1.0_r8+(my_temp-swim_T0)*oswim_DT)
-            j2=MIN(j1+1,swim_Jm)
+        i1=INT(1.0_r8+(my_size-swim_L0)*oswim_DL)
+        i2=MIN(i1+1,swim_Im)
+        j1=INT(1.0_r8+(my_temp-swim_T0)*oswim_DT)
+        j2=MIN(j1+1,swim_Jm)
 
-            p2=(my_size-(swim_L0+REAL(i1-1,r8)*swim_DL))*oswim_DL
-            q2=(my_temp-(swim_T0+REAL(j1-1,r8)*swim_DT))*oswim_DT
-            p1=1.0_r8-p2
-            q1=1.0_r8-q2
+        p2=(my_size-(swim_L0+REAL(i1-1,r8)*swim_DL))*oswim_DL
+        q2=(my_temp-(swim_T0+REAL(j1-1,r8)*swim_DT))*oswim_DT
+        p1=1.0_r8-p2
+        q1=1.0_r8-q2
 
-            SwimRate=p1*q1*swim_table(i1,j1)+                           &
-     &               p2*q1*swim_table(i2,j1)+                           &
-     &               p1*q2*swim_table(i1,j2)+                           &
-     &               p2*q2*swim_table(i2,j2)
+        SwimRate(ip)=p1*q1*swim_table(i1,j1)+                           &
+     &              p2*q1*swim_table(i2,j1)+                            &
+     &              p1*q2*swim_table(i1,j2)+                            &
+     &              p2*q2*swim_table(i2,j2)
 
-            SwimRate=SwimRate*0.001_r8        ! convert from mm/s to m/s
-          END IF
+        SwimRate(ip)=SwimRate(ip)*0.001_r8  ! convert from mm/s to m/s
+        IF ((temp(ip).lt.swim_T0).or.(Lsize(ip).lt.swim_L0)) THEN
+          SwimRate(ip)=0.0_r8
+        END IF
+      END DO
 !
-!  Compute larvae sinking velocity (m/s).
+!  Compute larvae sinking velocity (m/s) and vertical velocity (m/s).
 !
-          sink=sink_base(ng)*(EXP(sink_rate(ng)*(Lsize-sink_size(ng))))
+      DO ip=1,Nact
+        sink(ip)=sink_base(ng)*(EXP(sink_rate(ng)*                      &
+     &                             (Lsize(ip)-sink_size(ng))))
 
-          sink=sink*0.001_r8                  ! convert from mm/s to m/s
-!
-!  Compute larvae vertical velocity (m/s).
-!
+        sink(ip)=sink(ip)*0.001_r8          ! convert from mm/s to m/s
 #ifdef GROWTH_ONLY
-          w_bio=0.0_r8
+        w_bio(ip)=0.0_r8
 #else
-          w_bio=SwimTime*SwimRate-(1.0_r8-SwimTime)*sink
+        w_bio(ip)=SwimTime(ip)*SwimRate(ip)-                            &
+     &            (1.0_r8-SwimTime(ip))*sink(ip)
 #endif
+      END DO
 !
+!-----------------------------------------------------------------------
 !  Load behavior into track array. Apply settlement condition: larvae
-!  greater or equal than SETTLE_SIZE, settle on the bottom.
-!
-          IF (track(isizf,nfp1,l).lt.settle_size(ng)) THEN
-            track(iwbio,nfp1,l)=w_bio
-            track(iwsin,nfp1,l)=sink
-            track(iswim,nfp1,l)=SwimTimeNew
-          ELSE
-            i1=MIN(MAX(0,INT(track(ixgrd,nfp1,l))),Lm(ng)+1)
-            i2=MIN(i1+1,Lm(ng)+1)
-            j1=MIN(MAX(0,INT(track(iygrd,nfp1,l))),Mm(ng)+1)
-            j2=MIN(j1+1,Mm(ng)+1)
+!  greater or equal than SETTLE_SIZE, settle on the bottom.  The settled
+!  larvae are compacted into list "Lset".
+!-----------------------------------------------------------------------
+!
+      Nset=0
+      DO ip=1,Nact
+        l=Lact(ip)
+        IF (track(isizf,nfp1,l).lt.settle_size(ng)) THEN
+          track(iwbio,nfp1,l)=w_bio(ip)
+          track(iwsin,nfp1,l)=sink(ip)
+          track(iswim,nfp1,l)=SwimTimeNew(ip)
+        ELSE
+          Nset=Nset+1
+          Lset(Nset)=l
+        END IF
+      END DO
+!
+      DO ip=1,Nset
+        l=Lset(ip)
+        i1=MIN(MAX(0,INT(track(ixgrd,nfp1,l))),Lm(ng)+1)
+        i2=MIN(i1+1,Lm(ng)+1)
+        j1=MIN(MAX(0,INT(track(iygrd,nfp1,l))),Mm(ng)+1)
+        j2=MIN(j1+1,Mm(ng)+1)
 
-            p2=REAL(i2-i1,r8)*(track(ixgrd,nfp1,l)-REAL(i1,r8))
-            q2=REAL(j2-j1,r8)*(track(iygrd,nfp1,l)-REAL(j1,r8))
-            p1=1.0_r8-p2
-            q1=1.0_r8-q2
+        p2=REAL(i2-i1,r8)*(track(ixgrd,nfp1,l)-REAL(i1,r8))
+        q2=REAL(j2-j1,r8)*(track(iygrd,nfp1,l)-REAL(j1,r8))
+        p1=1.0_r8-p2
+        q1=1.0_r8-q2
 
-            bottom=p1*q1*GRID(ng)%h(i1,j1)+                             &
-     &             p2*q1*GRID(ng)%h(i2,j1)+                             &
-     &             p1*q2*GRID(ng)%h(i1,j2)+                             &
-     &             p2*q2*GRID(ng)%h(i2,j2)
+        bottom=p1*q1*GRID(ng)%h(i1,j1)+                                 &
+     &         p2*q1*GRID(ng)%h(i2,j1)+                                 &
+     &         p1*q2*GRID(ng)%h(i1,j2)+                                 &
+     &         p2*q2*GRID(ng)%h(i2,j2)
 
-            track(idpth,nfp1,l)=-bottom
-            track(isizf,nfp1,l)=track(isizf,nf,l)
-            track(iwbio,nfp1,l)=0.0_r8
-            track(iwsin,nfp1,l)=0.0_r8
-            track(iswim,nfp1,l)=0.0_r8
-          END IF
+        track(idpth,nfp1,l)=-bottom
+        track(isizf,nfp1,l)=track(isizf,nf,l)
+        track(iwbio,nfp1,l)=0.0_r8
+        track(iwsin,nfp1,l)=0.0_r8
+        track(iswim,nfp1,l)=0.0_r8
+      END DO
 !
 !  If newly relased float, set vertical migration fields for all time
 !  levels.
 !
-          IF (time(ng)-HalfDT.le.Tinfo(itstr,l).and.                    &
-     &        time(ng)+HalfDT.gt.Tinfo(itstr,l)) THEN
-            brhs=track(ibrhs,nfp1,l)
-            sink=track(iwsin,nfp1,l)
-            w_bio=track(iwbio,nfp1,l)
-            DO i=0,NFT
-              track(ibrhs,i,l)=brhs
-              track(iwsin,i,l)=sink
-              track(iwbio,i,l)=w_bio
-            END DO
-          END IF
-
+      DO ip=1,Nact
+        IF (Lnew(ip)) THEN
+          l=Lact(ip)
+          DO i=0,NFT
+            track(ibrhs,i,l)=track(ibrhs,nfp1,l)
+            track(iwsin,i,l)=track(iwsin,nfp1,l)
+            track(iwbio,i,l)=track(iwbio,nfp1,l)
+          END DO
         END IF
       END DO
 
@@ -30,7 +30,7 @@
 !
 !  Local variable declarations.
 !
-      integer :: Npts, Nval
+      integer :: Npts, Nval, io
       integer :: i, j, igrid, mc, nc, ng, status
       integer :: Ivalue(1)
 
@@ -58,7 +58,9 @@
 !  which signal termination of input data.
 !
       DO WHILE (.TRUE.)
-        READ (inp,'(a)',ERR=10,END=30) line
+        CALL inp_read (inp, line, io)
+        IF (io.gt.0) GO TO 10
+        IF (io.lt.0) GO TO 30
         status=decode_line(line, KeyWord, Nval, Cval, Rval)
         IF (status.gt.0) THEN
           SELECT CASE (TRIM(KeyWord))
@@ -128,8 +130,14 @@
                 swim_table=0.0_r8
                 Dmem(1)=Dmem(1)+REAL(swim_Im*swim_Jm,r8)
               END IF
+#if defined DISTRIBUTE && defined INPUT_BCAST
+              CALL inp_read_r (inp, swim_Im*swim_Jm, swim_table, io)
+              IF (io.gt.0) GO TO 20
+              IF (io.lt.0) GO TO 30
+#else
               READ (inp,*,ERR=20,END=30)                                &
                    ((swim_table(i,j),i=1,swim_Im),j=1,swim_Jm)
+#endif
             CASE ('Gfactor_Im')
               Npts=load_i(Nval, Rval, 1, Ivalue)
               Gfactor_Im=Ivalue(1)
@@ -154,8 +162,15 @@
                 Gfactor_table=0.0_r8
                 Dmem(1)=Dmem(1)+REAL(Gfactor_Im*Gfactor_Jm)
               END IF
+#if defined DISTRIBUTE && defined INPUT_BCAST
+              CALL inp_read_r (inp, Gfactor_Im*Gfactor_Jm,              &
+     &                         Gfactor_table, io)
+              IF (io.gt.0) GO TO 20
+              IF (io.lt.0) GO TO 30
+#else
               READ (inp,*,ERR=20,END=30)                                &
                    ((Gfactor_table(i,j),i=1,Gfactor_Im),j=1,Gfactor_Jm)
+#endif
             CASE ('Grate_Im')
               Npts=load_i(Nval, Rval, 1, Ivalue)
               Grate_Im=Ivalue(1)
@@ -178,10 +193,16 @@
               IF (.not.allocated(Grate_table)) THEN
                 allocate ( Grate_table(Grate_Im,Grate_Jm) )
                 Grate_table=0.0_r8
-                Dmem(1)*Dmem(1)+REAL(Grate_Im*Grate_Jm,r8)
+                Dmem(1)=Dmem(1)+REAL(Grate_Im*Grate_Jm,r8)
               END IF
+#if defined DISTRIBUTE && defined INPUT_BCAST
+              CALL inp_read_r (inp, Grate_Im*Grate_Jm, Grate_table, io)
+              IF (io.gt.0) GO TO 20
+              IF (io.lt.0) GO TO 30
+#else
               READ (inp,*,ERR=20,END=30)                                &
                    ((Grate_table(i,j),i=1,Grate_Im),j=1,Grate_Jm)
+#endif
           END SELECT
         END IF
       END DO
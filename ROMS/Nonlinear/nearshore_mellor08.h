@@ -341,7 +341,18 @@
       real(r8), dimension(IminS:ImaxS,JminS:JmaxS) :: ocosh
       real(r8), dimension(IminS:ImaxS,JminS:JmaxS) :: osinh
       real(r8), dimension(IminS:ImaxS,JminS:JmaxS) :: o2sinh
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS) :: ocosh_u
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS) :: ocosh_v
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS) :: osinh_u
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS) :: osinh_v
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS) :: sinh2_u
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS) :: sinh2_v
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,N(ng)) :: cosh_rad
       real(r8), dimension(IminS:ImaxS,JminS:JmaxS,N(ng)) :: z_psi
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,0:N(ng)) :: cosh_u
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,0:N(ng)) :: cosh_v
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,0:N(ng)) :: sinh_u
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,0:N(ng)) :: sinh_v
 # ifdef CURVGRID
       real(r8), dimension(IminS:ImaxS,JminS:JmaxS) :: UFx
 # endif
@@ -393,8 +404,8 @@
           gamr(i,j)=MIN(0.707_r8*Dstp(i,j)/(Hwave(i,j)+eps),1.0_r8)
           DO k=1,N(ng)
             cff2=(1.0_r8+SCALARS(ng)%Cs_r(k))*gamr(i,j)
-            orad(i,j)=orad(i,j)+Hz(i,j,k)*                              &
-     &                COSH(2.0_r8*pi*cff2)
+            cosh_rad(i,j,k)=COSH(2.0_r8*pi*cff2)
+            orad(i,j)=orad(i,j)+Hz(i,j,k)*cosh_rad(i,j,k)
           END DO
           orad(i,j)=1.0_r8/(orad(i,j)+eps)
 !
@@ -439,6 +450,47 @@
       END DO
 !
 !-----------------------------------------------------------------------
+!  Compute vertical structure functions at U- and V-points.  They only
+!  depend on the water column depth and wave number, so they are
+!  evaluated once and shared by the Stokes velocity, geopotential
+!  rotation, and vertical stress terms below.
+!-----------------------------------------------------------------------
+!
+      DO j=Jstr,Jend
+        DO i=IstrU,Iend
+          cff=0.5_r8*(kD(i,j)+kD(i-1,j))
+          ocosh_u(i,j)=1.0_r8/COSH(cff)
+          osinh_u(i,j)=1.0_r8/SINH(cff)
+          sinh2_u(i,j)=SINH(kD(i-1,j)+kD(i,j))
+        END DO
+        IF (j.ge.JstrV) THEN
+          DO i=Istr,Iend
+            cff=0.5_r8*(kD(i,j)+kD(i,j-1))
+            ocosh_v(i,j)=1.0_r8/COSH(cff)
+            osinh_v(i,j)=1.0_r8/SINH(cff)
+            sinh2_v(i,j)=SINH(kD(i,j-1)+kD(i,j))
+          END DO
+        END IF
+      END DO
+      DO k=0,N(ng)
+        cff2=1.0_r8+SCALARS(ng)%Cs_w(k)
+        DO j=Jstr,Jend
+          DO i=IstrU,Iend
+            cff=0.5_r8*(kD(i,j)+kD(i-1,j))
+            cosh_u(i,j,k)=COSH(cff*cff2)
+            sinh_u(i,j,k)=SINH(cff*cff2)
+          END DO
+          IF (j.ge.JstrV) THEN
+            DO i=Istr,Iend
+              cff=0.5_r8*(kD(i,j)+kD(i,j-1))
+              cosh_v(i,j,k)=COSH(cff*cff2)
+              sinh_v(i,j,k)=SINH(cff*cff2)
+            END DO
+          END IF
+        END DO
+      END DO
+!
+!-----------------------------------------------------------------------
 !  Compute diagonal [Sxx,Syy] and off-diagonal [Sxy,Syx] components
 !  of radiation stresses.
 !-----------------------------------------------------------------------
@@ -464,8 +516,7 @@
 !
 !  Vertical distribution of ED.
 !
-            cff2=(1.0_r8+SCALARS(ng)%Cs_r(k))*gamr(i,j)
-            cff3=COSH(2.0_r8*pi*cff2)
+            cff3=cosh_rad(i,j,k)
             ED=0.5_r8*waveE(i,j)
             cff4=-cff1*FSCr*FSSr+ED*cff3*orad(i,j)
 !!
@@ -548,7 +599,6 @@
           DO i=IstrU,Iend
             cff=fac1*om_u(i,j)*on_u(i,j)
             cff2=(waveE(i-1,j)+waveE(i,j))
-            cff3=(kD(i-1,j)+kD(i,j))
 
 # if defined SVENDSEN_ROLLER
 #  ifdef MONO_ROLLER
@@ -573,7 +623,7 @@
             u_stokes(i,j,k)=cff2*                                       &
      &                      (wavenx(i-1,j)+wavenx(i,j))/                &
      &                      (wavec (i-1,j)+wavec (i,j))*                &
-     &                      COSH(cff3*fac2)/SINH(cff3)
+     &                      COSH((kD(i-1,j)+kD(i,j))*fac2)/sinh2_u(i,j)
 # ifdef MASKING
             u_stokes(i,j,k)=u_stokes(i,j,k)*umask(i,j)
 # endif
@@ -620,7 +670,6 @@
           DO i=Istr,Iend
             cff=fac1*om_v(i,j)*on_v(i,j)
             cff2=(waveE(i,j-1)+waveE(i,j))
-            cff3=(kD(i,j-1)+kD(i,j))
 # if defined SVENDSEN_ROLLER
 #  ifdef MONO_ROLLER
 !
@@ -644,7 +693,7 @@
             v_stokes(i,j,k)=cff2*                                       &
      &                      (waveny(i,j-1)+waveny(i,j))/                &
      &                      (wavec (i,j-1)+wavec (i,j))*                &
-     &                      COSH(cff3*fac2)/SINH(cff3)
+     &                      COSH((kD(i,j-1)+kD(i,j))*fac2)/sinh2_v(i,j)
 # ifdef MASKING
             v_stokes(i,j,k)=v_stokes(i,j,k)*vmask(i,j)
 # endif
@@ -711,20 +760,15 @@
         END DO
       END DO
       DO j=Jstr,Jend
-        DO i=IstrU,Iend
-          UFe(i,j)=0.5_r8*(kD(i,j)+kD(i-1,j))
-          ocosh(i,j)=1.0_r8/COSH(UFe(i,j))
-          osinh(i,j)=1.0_r8/SINH(UFe(i,j))
-        END DO
         DO i=IstrU,Iend
           DO k=0,N(ng)
             cff1=0.5_r8*(waven(i  ,j)*waveE(i  ,j)+                     &
      &                   waven(i-1,j)*waveE(i-1,j))
             cff2=1.0_r8+SCALARS(ng)%Cs_w(k)
-            FCCr=COSH(UFe(i,j)*cff2)*ocosh(i,j)
-            FCSr=COSH(UFe(i,j)*cff2)*osinh(i,j)
-            FSCr=SINH(UFe(i,j)*cff2)*ocosh(i,j)
-            FSSr=SINH(UFe(i,j)*cff2)*osinh(i,j)
+            FCCr=cosh_u(i,j,k)*ocosh_u(i,j)
+            FCSr=cosh_u(i,j,k)*osinh_u(i,j)
+            FSCr=sinh_u(i,j,k)*ocosh_u(i,j)
+            FSSr=sinh_u(i,j,k)*osinh_u(i,j)
             waveEr(i,j)=cff1*FCSr*FCCr
 #  ifdef SVENDSEN_ROLLER
             cff3=SCALARS(ng)%Cs_w(k)
@@ -762,20 +806,15 @@
           END DO
         END DO
         IF (j.ge.JstrV) THEN
-          DO i=Istr,Iend
-            UFe(i,j)=0.5_r8*(kD(i,j)+kD(i,j-1))
-            ocosh(i,j)=1.0_r8/COSH(UFe(i,j))
-            osinh(i,j)=1.0_r8/SINH(UFe(i,j))
-          END DO
           DO i=Istr,Iend
             DO k=0,N(ng)
               cff1=0.5_r8*(waven(i,j  )*waveE(i,j  )+                   &
      &                     waven(i,j-1)*waveE(i,j-1))
               cff2=1.0_r8+SCALARS(ng)%Cs_w(k)
-              FCCr=COSH(UFe(i,j)*cff2)*ocosh(i,j)
-              FCSr=COSH(UFe(i,j)*cff2)*osinh(i,j)
-              FSCr=SINH(UFe(i,j)*cff2)*ocosh(i,j)
-              FSSr=SINH(UFe(i,j)*cff2)*osinh(i,j)
+              FCCr=cosh_v(i,j,k)*ocosh_v(i,j)
+              FCSr=cosh_v(i,j,k)*osinh_v(i,j)
+              FSCr=sinh_v(i,j,k)*ocosh_v(i,j)
+              FSSr=sinh_v(i,j,k)*osinh_v(i,j)
               waveEr(i,j)=cff1*FCSr*FCCr
 #  ifdef SVENDSEN_ROLLER
               cff3=SCALARS(ng)%Cs_w(k)
@@ -819,24 +858,17 @@
 !
 !-----------------------------------------------------------------------
 !  Determination of vertical stress terms.
-!  Notice reuse variable waveEr.
 !-----------------------------------------------------------------------
 !
 !  Component for U-momentum.
 !
       J_LOOP : DO j=Jstr,Jend
-        DO i=IstrU,Iend
-          waveEr(i,j)=0.5_r8*(kD(i,j)+kD(i-1,j))
-          ocosh(i,j)=1.0_r8/COSH(waveEr(i,j))
-          osinh(i,j)=1.0_r8/SINH(waveEr(i,j))
-        END DO
         DO i=IstrU,Iend
           DO k=0,N(ng)
-              cff2=1.0_r8+SCALARS(ng)%Cs_w(k)
-              FCC(i,k)=COSH(waveEr(i,j)*cff2)*ocosh(i,j)
-              FCS(i,k)=COSH(waveEr(i,j)*cff2)*osinh(i,j)
-              FSS(i,k)=SINH(waveEr(i,j)*cff2)*osinh(i,j)
-              FSC(i,k)=SINH(waveEr(i,j)*cff2)*ocosh(i,j)
+              FCC(i,k)=cosh_u(i,j,k)*ocosh_u(i,j)
+              FCS(i,k)=cosh_u(i,j,k)*osinh_u(i,j)
+              FSS(i,k)=sinh_u(i,j,k)*osinh_u(i,j)
+              FSC(i,k)=sinh_u(i,j,k)*ocosh_u(i,j)
           END DO
           cff1=0.25_r8*((waven(i,j)+waven(i-1,j))*                      &
      &                  (waveE(i,j)+waveE(i-1,j)))
@@ -882,18 +914,12 @@
 !  Component for V-momentum.
 !
         IF (j.ge.JstrV) THEN
-          DO i=Istr,Iend
-            waveEr(i,j)=0.5_r8*(kD(i,j)+kD(i,j-1))
-            ocosh(i,j)=1.0_r8/COSH(waveEr(i,j))
-            osinh(i,j)=1.0_r8/SINH(waveEr(i,j))
-          END DO
           DO i=Istr,Iend
             DO k=0,N(ng)
-              cff2=1.0_r8+SCALARS(ng)%Cs_w(k)
-              FCC(i,k)=COSH(waveEr(i,j)*cff2)*ocosh(i,j)
-              FCS(i,k)=COSH(waveEr(i,j)*cff2)*osinh(i,j)
-              FSS(i,k)=SINH(waveEr(i,j)*cff2)*osinh(i,j)
-              FSC(i,k)=SINH(waveEr(i,j)*cff2)*osinh(i,j)
+              FCC(i,k)=cosh_v(i,j,k)*ocosh_v(i,j)
+              FCS(i,k)=cosh_v(i,j,k)*osinh_v(i,j)
+              FSS(i,k)=sinh_v(i,j,k)*osinh_v(i,j)
+              FSC(i,k)=sinh_v(i,j,k)*osinh_v(i,j)
             END DO
             cff1=0.25_r8*((waven(i,j)+waven(i,j-1))*                    &
      &                    (waveE(i,j)+waveE(i,j-1)))
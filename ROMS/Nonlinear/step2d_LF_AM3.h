@@ -64,6 +64,8 @@
      &                  GRID(ng) % on_u,        GRID(ng) % on_v,        &
      &                  GRID(ng) % omn,                                 &
      &                  GRID(ng) % pm,          GRID(ng) % pn,          &
+     &                  GRID(ng) % pm_u,        GRID(ng) % pn_u,        &
+     &                  GRID(ng) % pm_v,        GRID(ng) % pn_v,        &
 # if defined CURVGRID && defined UV_ADV
      &                  GRID(ng) % dndx,        GRID(ng) % dmde,        &
 # endif
@@ -142,6 +144,7 @@
 # endif
      &                        fomn, h,                                  &
      &                        om_u, om_v, on_u, on_v, omn, pm, pn,      &
+     &                        pm_u, pn_u, pm_v, pn_v,                   &
 # if defined CURVGRID && defined UV_ADV
      &                        dndx, dmde,                               &
 # endif
@@ -233,6 +236,10 @@
       real(r8), intent(in) :: omn(LBi:,LBj:)
       real(r8), intent(in) :: pm(LBi:,LBj:)
       real(r8), intent(in) :: pn(LBi:,LBj:)
+      real(r8), intent(in) :: pm_u(LBi:,LBj:)
+      real(r8), intent(in) :: pn_u(LBi:,LBj:)
+      real(r8), intent(in) :: pm_v(LBi:,LBj:)
+      real(r8), intent(in) :: pn_v(LBi:,LBj:)
 #  if defined CURVGRID && defined UV_ADV
       real(r8), intent(in) :: dndx(LBi:,LBj:)
       real(r8), intent(in) :: dmde(LBi:,LBj:)
@@ -336,6 +343,10 @@
       real(r8), intent(in) :: omn(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: pm(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: pn(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pm_u(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pn_u(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pm_v(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pn_v(LBi:UBi,LBj:UBj)
 #  if defined CURVGRID && defined UV_ADV
       real(r8), intent(in) :: dndx(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: dmde(LBi:UBi,LBj:UBj)
@@ -1368,26 +1379,26 @@
 !
       DO j=JstrV-1,Jend
         DO i=IstrU-1,Iend
-          cff=visc2_r(i,j)*Drhs(i,j)*0.5_r8*                            &
+          cff=visc2_r(i,j)*Drhs(i,j)*                                   &
      &        (pmon_r(i,j)*                                             &
-     &         ((pn(i  ,j)+pn(i+1,j))*ubar(i+1,j,krhs)-                 &
-     &          (pn(i-1,j)+pn(i  ,j))*ubar(i  ,j,krhs))-                &
+     &         (pn_u(i+1,j)*ubar(i+1,j,krhs)-                           &
+     &          pn_u(i  ,j)*ubar(i  ,j,krhs))-                          &
      &         pnom_r(i,j)*                                             &
-     &         ((pm(i,j  )+pm(i,j+1))*vbar(i,j+1,krhs)-                 &
-     &          (pm(i,j-1)+pm(i,j  ))*vbar(i,j  ,krhs)))
+     &         (pm_v(i,j+1)*vbar(i,j+1,krhs)-                           &
+     &          pm_v(i,j  )*vbar(i,j  ,krhs)))
           UFx(i,j)=on_r(i,j)*on_r(i,j)*cff
           VFe(i,j)=om_r(i,j)*om_r(i,j)*cff
         END DO
       END DO
       DO j=Jstr,Jend+1
         DO i=Istr,Iend+1
-          cff=visc2_p(i,j)*Drhs_p(i,j)*0.5_r8*                          &
+          cff=visc2_p(i,j)*Drhs_p(i,j)*                                 &
      &        (pmon_p(i,j)*                                             &
-     &         ((pn(i  ,j-1)+pn(i  ,j))*vbar(i  ,j,krhs)-               &
-     &          (pn(i-1,j-1)+pn(i-1,j))*vbar(i-1,j,krhs))+              &
+     &         (pn_v(i  ,j)*vbar(i  ,j,krhs)-                           &
+     &          pn_v(i-1,j)*vbar(i-1,j,krhs))+                          &
      &         pnom_p(i,j)*                                             &
-     &         ((pm(i-1,j  )+pm(i,j  ))*ubar(i,j  ,krhs)-               &
-     &          (pm(i-1,j-1)+pm(i,j-1))*ubar(i,j-1,krhs)))
+     &         (pm_u(i,j  )*ubar(i,j  ,krhs)-                           &
+     &          pm_u(i,j-1)*ubar(i,j-1,krhs)))
 #   ifdef MASKING
           cff=cff*pmask(i,j)
 #   endif
@@ -1403,8 +1414,8 @@
 !
       DO j=Jstr,Jend
         DO i=IstrU,Iend
-          cff1=0.5_r8*(pn(i-1,j)+pn(i,j))*(UFx(i,j  )-UFx(i-1,j))
-          cff2=0.5_r8*(pm(i-1,j)+pm(i,j))*(UFe(i,j+1)-UFe(i  ,j))
+          cff1=pn_u(i,j)*(UFx(i,j  )-UFx(i-1,j))
+          cff2=pm_u(i,j)*(UFe(i,j+1)-UFe(i  ,j))
           fac=cff1+cff2
           rhs_ubar(i,j)=rhs_ubar(i,j)+fac
 #  if defined DIAGNOSTICS_UV
@@ -1416,8 +1427,8 @@
       END DO
       DO j=JstrV,Jend
         DO i=Istr,Iend
-          cff1=0.5_r8*(pn(i,j-1)+pn(i,j))*(VFx(i+1,j)-VFx(i,j  ))
-          cff2=0.5_r8*(pm(i,j-1)+pm(i,j))*(VFe(i  ,j)-VFe(i,j-1))
+          cff1=pn_v(i,j)*(VFx(i+1,j)-VFx(i,j  ))
+          cff2=pm_v(i,j)*(VFe(i  ,j)-VFe(i,j-1))
           fac=cff1-cff2
           rhs_vbar(i,j)=rhs_vbar(i,j)+fac
 #  if defined DIAGNOSTICS_UV
@@ -1444,26 +1455,26 @@
 !
       DO j=JstrVm2,Jendp1
         DO i=IstrUm2,Iendp1
-          cff=visc4_r(i,j)*0.5_r8*                                      &
+          cff=visc4_r(i,j)*                                             &
      &        (pmon_r(i,j)*                                             &
-     &         ((pn(i  ,j)+pn(i+1,j))*ubar(i+1,j,krhs)-                 &
-     &          (pn(i-1,j)+pn(i  ,j))*ubar(i  ,j,krhs))-                &
+     &         (pn_u(i+1,j)*ubar(i+1,j,krhs)-                           &
+     &          pn_u(i  ,j)*ubar(i  ,j,krhs))-                          &
      &         pnom_r(i,j)*                                             &
-     &         ((pm(i,j  )+pm(i,j+1))*vbar(i,j+1,krhs)-                 &
-     &          (pm(i,j-1)+pm(i,j  ))*vbar(i,j  ,krhs)))
+     &         (pm_v(i,j+1)*vbar(i,j+1,krhs)-                           &
+     &          pm_v(i,j  )*vbar(i,j  ,krhs)))
           UFx(i,j)=on_r(i,j)*on_r(i,j)*cff
           VFe(i,j)=om_r(i,j)*om_r(i,j)*cff
         END DO
       END DO
       DO j=Jstrm1,Jendp2
         DO i=Istrm1,Iendp2
-          cff=visc4_p(i,j)*0.5_r8*                                      &
+          cff=visc4_p(i,j)*                                             &
      &        (pmon_p(i,j)*                                             &
-     &         ((pn(i  ,j-1)+pn(i  ,j))*vbar(i  ,j,krhs)-               &
-     &          (pn(i-1,j-1)+pn(i-1,j))*vbar(i-1,j,krhs))+              &
+     &         (pn_v(i  ,j)*vbar(i  ,j,krhs)-                           &
+     &          pn_v(i-1,j)*vbar(i-1,j,krhs))+                          &
      &         pnom_p(i,j)*                                             &
-     &         ((pm(i-1,j  )+pm(i,j  ))*ubar(i,j  ,krhs)-               &
-     &          (pm(i-1,j-1)+pm(i,j-1))*ubar(i,j-1,krhs)))
+     &         (pm_u(i,j  )*ubar(i,j  ,krhs)-                           &
+     &          pm_u(i,j-1)*ubar(i,j-1,krhs)))
 #  ifdef MASKING
           cff=cff*pmask(i,j)
 #  endif
@@ -1479,21 +1490,19 @@
 !
       DO j=Jstrm1,Jendp1
         DO i=IstrUm1,Iendp1
-          LapU(i,j)=0.125_r8*                                           &
-     &              (pm(i-1,j)+pm(i,j))*(pn(i-1,j)+pn(i,j))*            &
-     &              ((pn(i-1,j)+pn(i,j))*                               &
+          LapU(i,j)=pm_u(i,j)*pn_u(i,j)*                                &
+     &              (pn_u(i,j)*                                         &
      &               (UFx(i,j  )-UFx(i-1,j))+                           &
-     &               (pm(i-1,j)+pm(i,j))*                               &
+     &               pm_u(i,j)*                                         &
      &               (UFe(i,j+1)-UFe(i  ,j)))
         END DO
       END DO
       DO j=JstrVm1,Jendp1
         DO i=Istrm1,Iendp1
-          LapV(i,j)=0.125_r8*                                           &
-     &              (pm(i,j)+pm(i,j-1))*(pn(i,j)+pn(i,j-1))*            &
-     &              ((pn(i,j-1)+pn(i,j))*                               &
+          LapV(i,j)=pm_v(i,j)*pn_v(i,j)*                                &
+     &              (pn_v(i,j)*                                         &
      &               (VFx(i+1,j)-VFx(i,j  ))-                           &
-     &               (pm(i,j-1)+pm(i,j))*                               &
+     &               pm_v(i,j)*                                         &
      &               (VFe(i  ,j)-VFe(i,j-1)))
         END DO
       END DO
@@ -1639,26 +1648,26 @@
 !
       DO j=JstrV-1,Jend
         DO i=IstrU-1,Iend
-          cff=visc4_r(i,j)*Drhs(i,j)*0.5_r8*                            &
+          cff=visc4_r(i,j)*Drhs(i,j)*                                   &
      &        (pmon_r(i,j)*                                             &
-     &         ((pn(i  ,j)+pn(i+1,j))*LapU(i+1,j)-                      &
-     &          (pn(i-1,j)+pn(i  ,j))*LapU(i  ,j))-                     &
+     &         (pn_u(i+1,j)*LapU(i+1,j)-                                &
+     &          pn_u(i  ,j)*LapU(i  ,j))-                               &
      &         pnom_r(i,j)*                                             &
-     &         ((pm(i,j  )+pm(i,j+1))*LapV(i,j+1)-                      &
-     &          (pm(i,j-1)+pm(i,j  ))*LapV(i,j  )))
+     &         (pm_v(i,j+1)*LapV(i,j+1)-                                &
+     &          pm_v(i,j  )*LapV(i,j  )))
           UFx(i,j)=on_r(i,j)*on_r(i,j)*cff
           VFe(i,j)=om_r(i,j)*om_r(i,j)*cff
         END DO
       END DO
       DO j=Jstr,Jend+1
         DO i=Istr,Iend+1
-          cff=visc4_p(i,j)*Drhs_p(i,j)*0.5_r8*                          &
+          cff=visc4_p(i,j)*Drhs_p(i,j)*                                 &
      &        (pmon_p(i,j)*                                             &
-     &         ((pn(i  ,j-1)+pn(i  ,j))*LapV(i  ,j)-                    &
-     &          (pn(i-1,j-1)+pn(i-1,j))*LapV(i-1,j))+                   &
+     &         (pn_v(i  ,j)*LapV(i  ,j)-                                &
+     &          pn_v(i-1,j)*LapV(i-1,j))+                               &
      &         pnom_p(i,j)*                                             &
-     &         ((pm(i-1,j  )+pm(i,j  ))*LapU(i,j  )-                    &
-     &          (pm(i-1,j-1)+pm(i,j-1))*LapU(i,j-1)))
+     &         (pm_u(i,j  )*LapU(i,j  )-                                &
+     &          pm_u(i,j-1)*LapU(i,j-1)))
 #  ifdef MASKING
           cff=cff*pmask(i,j)
 #  endif
@@ -1674,8 +1683,8 @@
 !
       DO j=Jstr,Jend
         DO i=IstrU,Iend
-          cff1=0.5_r8*(pn(i-1,j)+pn(i,j))*(UFx(i,j  )-UFx(i-1,j))
-          cff2=0.5_r8*(pm(i-1,j)+pm(i,j))*(UFe(i,j+1)-UFe(i  ,j))
+          cff1=pn_u(i,j)*(UFx(i,j  )-UFx(i-1,j))
+          cff2=pm_u(i,j)*(UFe(i,j+1)-UFe(i  ,j))
           fac=cff1+cff2
           rhs_ubar(i,j)=rhs_ubar(i,j)-fac
 #  if defined DIAGNOSTICS_UV
@@ -1687,8 +1696,8 @@
       END DO
       DO j=JstrV,Jend
         DO i=Istr,Iend
-          cff1=0.5_r8*(pn(i,j-1)+pn(i,j))*(VFx(i+1,j)-VFx(i,j  ))
-          cff2=0.5_r8*(pm(i,j-1)+pm(i,j))*(VFe(i  ,j)-VFe(i,j-1))
+          cff1=pn_v(i,j)*(VFx(i+1,j)-VFx(i,j  ))
+          cff2=pm_v(i,j)*(VFe(i  ,j)-VFe(i,j-1))
           fac=cff1-cff2
           rhs_vbar(i,j)=rhs_vbar(i,j)-fac
 #  if defined DIAGNOSTICS_UV
@@ -2070,7 +2079,7 @@
 # endif
         DO j=Jstr,Jend
           DO i=IstrU,Iend
-            cff=(pm(i,j)+pm(i-1,j))*(pn(i,j)+pn(i-1,j))
+            cff=4.0_r8*pm_u(i,j)*pn_u(i,j)
             fac=1.0_r8/(Dnew(i,j)+Dnew(i-1,j))
             ubar(i,j,knew)=(ubar(i,j,kstp)*                             &
      &                      (Dstp(i,j)+Dstp(i-1,j))+                    &
@@ -2095,7 +2104,7 @@
         END DO
         DO j=JstrV,Jend
           DO i=Istr,Iend
-            cff=(pm(i,j)+pm(i,j-1))*(pn(i,j)+pn(i,j-1))
+            cff=4.0_r8*pm_v(i,j)*pn_v(i,j)
             fac=1.0_r8/(Dnew(i,j)+Dnew(i,j-1))
             vbar(i,j,knew)=(vbar(i,j,kstp)*                             &
      &                      (Dstp(i,j)+Dstp(i,j-1))+                    &
@@ -2125,7 +2134,7 @@
 # endif
         DO j=Jstr,Jend
           DO i=IstrU,Iend
-            cff=(pm(i,j)+pm(i-1,j))*(pn(i,j)+pn(i-1,j))
+            cff=4.0_r8*pm_u(i,j)*pn_u(i,j)
             fac=1.0_r8/(Dnew(i,j)+Dnew(i-1,j))
             ubar(i,j,knew)=(ubar(i,j,kstp)*                             &
      &                      (Dstp(i,j)+Dstp(i-1,j))+                    &
@@ -2144,7 +2153,7 @@
         END DO
         DO j=JstrV,Jend
           DO i=Istr,Iend
-            cff=(pm(i,j)+pm(i,j-1))*(pn(i,j)+pn(i,j-1))
+            cff=4.0_r8*pm_v(i,j)*pn_v(i,j)
             fac=1.0_r8/(Dnew(i,j)+Dnew(i,j-1))
             vbar(i,j,knew)=(vbar(i,j,kstp)*                             &
      &                      (Dstp(i,j)+Dstp(i,j-1))+                    &
@@ -2170,7 +2179,7 @@
 # endif
         DO j=Jstr,Jend
           DO i=IstrU,Iend
-            cff=(pm(i,j)+pm(i-1,j))*(pn(i,j)+pn(i-1,j))
+            cff=4.0_r8*pm_u(i,j)*pn_u(i,j)
             fac=1.0_r8/(Dnew(i,j)+Dnew(i-1,j))
             ubar(i,j,knew)=(ubar(i,j,kstp)*                             &
      &                      (Dstp(i,j)+Dstp(i-1,j))+                    &
@@ -2191,7 +2200,7 @@
         END DO
         DO j=JstrV,Jend
           DO i=Istr,Iend
-            cff=(pm(i,j)+pm(i,j-1))*(pn(i,j)+pn(i,j-1))
+            cff=4.0_r8*pm_v(i,j)*pn_v(i,j)
             fac=1.0_r8/(Dnew(i,j)+Dnew(i,j-1))
             vbar(i,j,knew)=(vbar(i,j,kstp)*                             &
      &                      (Dstp(i,j)+Dstp(i,j-1))+                    &
@@ -2250,14 +2259,14 @@
             DO i=IstrU,Iend
               DiaU2int(i,j,idiag)=cff1*DiaU2rhs(i,j,idiag)
               DiaU2wrk(i,j,idiag)=DiaU2int(i,j,idiag)*                  &
-     &                            (pm(i-1,j)+pm(i,j))*fac
+     &                            2.0_r8*pm_u(i,j)*fac
             END DO
           END DO
           DO j=JstrV,Jend
             DO i=Istr,Iend
               DiaV2int(i,j,idiag)=cff1*DiaV2rhs(i,j,idiag)
               DiaV2wrk(i,j,idiag)=DiaV2int(i,j,idiag)*                  &
-     &                            (pn(i,j)+pn(i,j-1))*fac
+     &                            2.0_r8*pn_v(i,j)*fac
             END DO
           END DO
         END DO
@@ -2274,7 +2283,7 @@
      &                             cff3*DiaRUbar(i,j,ptsk,idiag))
               DiaU2wrk(i,j,idiag)=DiaU2wrk(i,j,idiag)+                  &
      &                            DiaU2int(i,j,idiag)*                  &
-     &                            (pm(i-1,j)+pm(i,j))*fac
+     &                            2.0_r8*pm_u(i,j)*fac
             END DO
           END DO
           DO j=JstrV,Jend
@@ -2285,7 +2294,7 @@
      &                             cff3*DiaRVbar(i,j,ptsk,idiag))
               DiaV2wrk(i,j,idiag)=DiaV2wrk(i,j,idiag)+                  &
      &                            DiaV2int(i,j,idiag)*                  &
-     &                            (pn(i,j)+pn(i,j-1))*fac
+     &                            2.0_r8*pn_v(i,j)*fac
             END DO
           END DO
         END DO
@@ -2299,14 +2308,14 @@
         DO idiag=1,NDM2d-1
           DO j=Jstr,Jend
             DO i=IstrU,Iend
-              cff=(pm(i,j)+pm(i-1,j))*(pn(i,j)+pn(i-1,j))
+              cff=4.0_r8*pm_u(i,j)*pn_u(i,j)
               fac=1.0_r8/(Dnew(i,j)+Dnew(i-1,j))
               DiaU2wrk(i,j,idiag)=cff*cff1*DiaU2rhs(i,j,idiag)*fac
             END DO
           END DO
           DO j=JstrV,Jend
             DO i=Istr,Iend
-              cff=(pm(i,j)+pm(i,j-1))*(pn(i,j)+pn(i,j-1))
+              cff=4.0_r8*pm_v(i,j)*pn_v(i,j)
               fac=1.0_r8/(Dnew(i,j)+Dnew(i,j-1))
               DiaV2wrk(i,j,idiag)=cff*cff1*DiaV2rhs(i,j,idiag)*fac
             END DO
@@ -2333,7 +2342,7 @@
         DO idiag=1,NDM2d-1
           DO j=Jstr,Jend
             DO i=IstrU,Iend
-              cff=(pm(i,j)+pm(i-1,j))*(pn(i,j)+pn(i-1,j))
+              cff=4.0_r8*pm_u(i,j)*pn_u(i,j)
               fac=1.0_r8/(Dnew(i,j)+Dnew(i-1,j))
               DiaU2wrk(i,j,idiag)=cff*(cff1*DiaU2rhs(i,j,idiag)+        &
      &                                 cff2*DiaRUbar(i,j,kstp,idiag)-   &
@@ -2343,7 +2352,7 @@
           END DO
           DO j=JstrV,Jend
             DO i=Istr,Iend
-              cff=(pm(i,j)+pm(i,j-1))*(pn(i,j)+pn(i,j-1))
+              cff=4.0_r8*pm_v(i,j)*pn_v(i,j)
               fac=1.0_r8/(Dnew(i,j)+Dnew(i,j-1))
               DiaV2wrk(i,j,idiag)=cff*(cff1*DiaV2rhs(i,j,idiag)+        &
      &                                 cff2*DiaRVbar(i,j,kstp,idiag)-   &
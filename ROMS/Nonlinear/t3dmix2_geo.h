@@ -51,7 +51,9 @@
      &                   GRID(ng) % om_v,                               &
      &                   GRID(ng) % on_u,                               &
      &                   GRID(ng) % pm,                                 &
+     &                   GRID(ng) % pm_u,                               &
      &                   GRID(ng) % pn,                                 &
+     &                   GRID(ng) % pn_v,                               &
      &                   GRID(ng) % Hz,                                 &
      &                   GRID(ng) % z_r,                                &
 #ifdef DIFF_3DCOEF
@@ -83,7 +85,7 @@
 #ifdef WET_DRY
      &                         umask_wet, vmask_wet,                    &
 #endif
-     &                         om_v, on_u, pm, pn,                      &
+     &                         om_v, on_u, pm, pm_u, pn, pn_v,          &
      &                         Hz, z_r,                                 &
 #ifdef DIFF_3DCOEF
      &                         diff3d_r,                                &
@@ -126,7 +128,9 @@
       real(r8), intent(in) :: om_v(LBi:,LBj:)
       real(r8), intent(in) :: on_u(LBi:,LBj:)
       real(r8), intent(in) :: pm(LBi:,LBj:)
+      real(r8), intent(in) :: pm_u(LBi:,LBj:)
       real(r8), intent(in) :: pn(LBi:,LBj:)
+      real(r8), intent(in) :: pn_v(LBi:,LBj:)
       real(r8), intent(in) :: Hz(LBi:,LBj:,:)
       real(r8), intent(in) :: z_r(LBi:,LBj:,:)
 # ifdef TS_MIX_CLIMA
@@ -153,7 +157,9 @@
       real(r8), intent(in) :: om_v(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: on_u(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: pm(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pm_u(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: pn(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pn_v(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: Hz(LBi:UBi,LBj:UBj,N(ng))
       real(r8), intent(in) :: z_r(LBi:UBi,LBj:UBj,N(ng))
 # ifdef TS_MIX_CLIMA
@@ -210,7 +216,7 @@
           IF (k.lt.N(ng)) THEN
             DO j=Jstr,Jend
               DO i=Istr,Iend+1
-                cff=0.5_r8*(pm(i,j)+pm(i-1,j))
+                cff=pm_u(i,j)
 #ifdef MASKING
                 cff=cff*umask(i,j)
 #endif
@@ -242,7 +248,7 @@
             END DO
             DO j=Jstr,Jend+1
               DO i=Istr,Iend
-                cff=0.5_r8*(pn(i,j)+pn(i,j-1))
+                cff=pn_v(i,j)
 #ifdef MASKING
                 cff=cff*vmask(i,j)
 #endif
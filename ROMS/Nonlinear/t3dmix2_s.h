@@ -53,7 +53,15 @@
      &                   GRID(ng) % pnom_v,                             &
      &                   GRID(ng) % pm,                                 &
      &                   GRID(ng) % pn,                                 &
-#ifdef DIFF_3DCOEF
+#if defined DIFF_3DFUSED
+# ifdef MASKING
+     &                   GRID(ng) % rmask,                              &
+# endif
+     &                   GRID(ng) % omn,                                &
+     &                   MIXING(ng) % Hdiffusion,                       &
+     &                   OCEAN(ng) % u,                                 &
+     &                   OCEAN(ng) % v,                                 &
+#elif defined DIFF_3DCOEF
      &                   MIXING(ng) % diff3d_r,                         &
 #else
      &                   MIXING(ng) % diff2,                            &
@@ -83,7 +91,12 @@
      &                         umask_wet, vmask_wet,                    &
 #endif
      &                         Hz, pmon_u, pnom_v, pm, pn,              &
-#ifdef DIFF_3DCOEF
+#if defined DIFF_3DFUSED
+# ifdef MASKING
+     &                         rmask,                                   &
+# endif
+     &                         omn, Hdiffusion, u, v,                   &
+#elif defined DIFF_3DCOEF
      &                         diff3d_r,                                &
 #else
      &                         diff2,                                   &
@@ -99,6 +112,10 @@
 !
       USE mod_param
       USE mod_scalars
+#ifdef DIFF_3DFUSED
+!
+      USE hmixing_mod, ONLY : hmixing_k
+#endif
 !
 !  Imported variable declarations.
 !
@@ -116,7 +133,15 @@
       real(r8), intent(in) :: umask_wet(LBi:,LBj:)
       real(r8), intent(in) :: vmask_wet(LBi:,LBj:)
 # endif
-# ifdef DIFF_3DCOEF
+# if defined DIFF_3DFUSED
+#  ifdef MASKING
+      real(r8), intent(in) :: rmask(LBi:,LBj:)
+#  endif
+      real(r8), intent(in) :: omn(LBi:,LBj:)
+      real(r8), intent(in) :: Hdiffusion(LBi:,LBj:)
+      real(r8), intent(in) :: u(LBi:,LBj:,:,:)
+      real(r8), intent(in) :: v(LBi:,LBj:,:,:)
+# elif defined DIFF_3DCOEF
       real(r8), intent(in) :: diff3d_r(LBi:,LBj:,:)
 # else
       real(r8), intent(in) :: diff2(LBi:,LBj:,:)
@@ -142,7 +167,15 @@
       real(r8), intent(in) :: umask_wet(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: vmask_wet(LBi:UBi,LBj:UBj)
 # endif
-# ifdef DIFF_3DCOEF
+# if defined DIFF_3DFUSED
+#  ifdef MASKING
+      real(r8), intent(in) :: rmask(LBi:UBi,LBj:UBj)
+#  endif
+      real(r8), intent(in) :: omn(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: Hdiffusion(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: u(LBi:UBi,LBj:UBj,N(ng),2)
+      real(r8), intent(in) :: v(LBi:UBi,LBj:UBj,N(ng),2)
+# elif defined DIFF_3DCOEF
       real(r8), intent(in) :: diff3d_r(LBi:UBi,LBj:UBj,N(ng))
 # else
       real(r8), intent(in) :: diff2(LBi:UBi,LBj:UBj,NT(ng))
@@ -168,6 +201,9 @@
 
       real(r8) :: cff, cff1, cff2, cff3
 
+#ifdef DIFF_3DFUSED
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS) :: diff3d
+#endif
       real(r8), dimension(IminS:ImaxS,JminS:JmaxS) :: FE
       real(r8), dimension(IminS:ImaxS,JminS:JmaxS) :: FX
 
@@ -179,16 +215,37 @@
 !  In order to increase stability, the harmonic operator is applied
 !  as: 3/4 t(:,:,:,nrhs,:) + 1/4 t(:,:,:,nstp,:).
 #endif
+#ifdef DIFF_3DFUSED
+!  The Smagorinsky diffusion coefficient is computed once per level
+!  and used for all tracers.
+#endif
 !-----------------------------------------------------------------------
 !
+#ifdef DIFF_3DFUSED
+      DO k=1,N(ng)
+        CALL hmixing_k (ng, tile, k,                                    &
+     &                  LBi, UBi, LBj, UBj,                             &
+     &                  IminS, ImaxS, JminS, JmaxS,                     &
+     &                  nrhs,                                           &
+# ifdef MASKING
+     &                  rmask,                                          &
+# endif
+     &                  pm, pn, omn, Hdiffusion,                        &
+     &                  u, v, diff3d)
+        DO itrc=1,NT(ng)
+#else
       DO itrc=1,NT(ng)
         DO k=1,N(ng)
+#endif
 !
 !  Compute XI- and ETA-components of diffusive tracer flux (T m3/s).
 !
           DO j=Jstr,Jend
             DO i=Istr,Iend+1
-#ifdef DIFF_3DCOEF
+#if defined DIFF_3DFUSED
+              cff=0.25_r8*(diff3d(i,j)+diff3d(i-1,j))*                  &
+     &            pmon_u(i,j)
+#elif defined DIFF_3DCOEF
               cff=0.25_r8*(diff3d_r(i,j,k)+diff3d_r(i-1,j,k))*          &
      &            pmon_u(i,j)
 #else
@@ -228,7 +285,10 @@
           END DO
           DO j=Jstr,Jend+1
             DO i=Istr,Iend
-#ifdef DIFF_3DCOEF
+#if defined DIFF_3DFUSED
+              cff=0.25_r8*(diff3d(i,j)+diff3d(i,j-1))*                  &
+     &            pnom_v(i,j)
+#elif defined DIFF_3DCOEF
               cff=0.25_r8*(diff3d_r(i,j,k)+diff3d_r(i,j-1,k))*          &
      &            pnom_v(i,j)
 #else
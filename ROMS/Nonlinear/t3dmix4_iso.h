@@ -51,7 +51,9 @@
      &                   GRID(ng) % om_v,                               &
      &                   GRID(ng) % on_u,                               &
      &                   GRID(ng) % pm,                                 &
+     &                   GRID(ng) % pm_u,                               &
      &                   GRID(ng) % pn,                                 &
+     &                   GRID(ng) % pn_v,                               &
      &                   GRID(ng) % Hz,                                 &
      &                   GRID(ng) % z_r,                                &
 #ifdef DIFF_3DCOEF
@@ -90,7 +92,7 @@
 #ifdef WET_DRY
      &                         umask_wet, vmask_wet,                    &
 #endif
-     &                         om_v, on_u, pm, pn,                      &
+     &                         om_v, on_u, pm, pm_u, pn, pn_v,          &
      &                         Hz, z_r,                                 &
 #ifdef DIFF_3DCOEF
 # ifdef TS_U3ADV_SPLIT
@@ -144,7 +146,9 @@
       real(r8), intent(in) :: om_v(LBi:,LBj:)
       real(r8), intent(in) :: on_u(LBi:,LBj:)
       real(r8), intent(in) :: pm(LBi:,LBj:)
+      real(r8), intent(in) :: pm_u(LBi:,LBj:)
       real(r8), intent(in) :: pn(LBi:,LBj:)
+      real(r8), intent(in) :: pn_v(LBi:,LBj:)
       real(r8), intent(in) :: Hz(LBi:,LBj:,:)
       real(r8), intent(in) :: z_r(LBi:,LBj:,:)
       real(r8), intent(in) :: pden(LBi:,LBj:,:)
@@ -177,7 +181,9 @@
       real(r8), intent(in) :: om_v(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: on_u(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: pm(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pm_u(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: pn(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pn_v(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: Hz(LBi:UBi,LBj:UBj,N(ng))
       real(r8), intent(in) :: z_r(LBi:UBi,LBj:UBj,N(ng))
       real(r8), intent(in) :: pden(LBi:UBi,LBj:UBj,N(ng))
@@ -262,7 +268,7 @@
           IF (k.lt.N(ng)) THEN
             DO j=Jmin,Jmax
               DO i=Imin,Imax+1
-                cff=0.5_r8*(pm(i,j)+pm(i-1,j))
+                cff=pm_u(i,j)
 #ifdef MASKING
                 cff=cff*umask(i,j)
 #endif
@@ -294,7 +300,7 @@
             END DO
             DO j=Jmin,Jmax+1
               DO i=Imin,Imax
-                cff=0.5_r8*(pn(i,j)+pn(i,j-1))
+                cff=pn_v(i,j)
 #ifdef MASKING
                 cff=cff*vmask(i,j)
 #endif
@@ -614,7 +620,7 @@
           IF (k.lt.N(ng)) THEN
             DO j=Jstr,Jend
               DO i=Istr,Iend+1
-                cff=0.5_r8*(pm(i,j)+pm(i-1,j))
+                cff=pm_u(i,j)
 #ifdef MASKING
                 cff=cff*umask(i,j)
 #endif
@@ -629,7 +635,7 @@
             END DO
             DO j=Jstr,Jend+1
               DO i=Istr,Iend
-                cff=0.5_r8*(pn(i,j)+pn(i,j-1))
+                cff=pn_v(i,j)
 #ifdef MASKING
                 cff=cff*vmask(i,j)
 #endif
@@ -78,7 +78,11 @@
      &                    GRID(ng) % on_u,                              &
      &                    GRID(ng) % on_v,                              &
      &                    GRID(ng) % pm,                                &
+     &                    GRID(ng) % pm_u,                              &
+     &                    GRID(ng) % pm_v,                              &
      &                    GRID(ng) % pn,                                &
+     &                    GRID(ng) % pn_u,                              &
+     &                    GRID(ng) % pn_v,                              &
      &                    GRID(ng) % Hz,                                &
      &                    GRID(ng) % z_r,                               &
 #ifdef VISC_3DCOEF
@@ -117,7 +121,7 @@
 #endif
      &                          om_p, om_r, om_u, om_v,                 &
      &                          on_p, on_r, on_u, on_v,                 &
-     &                          pm, pn,                                 &
+     &                          pm, pm_u, pm_v, pn, pn_u, pn_v,         &
      &                          Hz, z_r,                                &
 #ifdef VISC_3DCOEF
      &                          visc3d_r,                               &
@@ -164,7 +168,11 @@
       real(r8), intent(in) :: on_u(LBi:,LBj:)
       real(r8), intent(in) :: on_v(LBi:,LBj:)
       real(r8), intent(in) :: pm(LBi:,LBj:)
+      real(r8), intent(in) :: pm_u(LBi:,LBj:)
+      real(r8), intent(in) :: pm_v(LBi:,LBj:)
       real(r8), intent(in) :: pn(LBi:,LBj:)
+      real(r8), intent(in) :: pn_u(LBi:,LBj:)
+      real(r8), intent(in) :: pn_v(LBi:,LBj:)
       real(r8), intent(in) :: Hz(LBi:,LBj:,:)
       real(r8), intent(in) :: z_r(LBi:,LBj:,:)
 # ifdef VISC_3DCOEF
@@ -205,7 +213,11 @@
       real(r8), intent(in) :: on_u(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: on_v(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: pm(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pm_u(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pm_v(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: pn(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pn_u(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pn_v(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: Hz(LBi:UBi,LBj:UBj,N(ng))
       real(r8), intent(in) :: z_r(LBi:UBi,LBj:UBj,N(ng))
 # ifdef VISC_3DCOEF
@@ -285,7 +297,7 @@
 !
           DO j=Jstr-1,Jend+1
             DO i=IstrU-1,Iend+1
-              cff=0.5_r8*(pm(i-1,j)+pm(i,j))
+              cff=pm_u(i,j)
 #ifdef MASKING
               cff=cff*umask(i,j)
 #endif
@@ -298,7 +310,7 @@
           END DO
           DO j=JstrV-1,Jend+1
             DO i=Istr-1,Iend+1
-              cff=0.5_r8*(pn(i,j-1)+pn(i,j))
+              cff=pn_v(i,j)
 #ifdef MASKING
               cff=cff*vmask(i,j)
 #endif
@@ -540,13 +552,13 @@
                 fac1=cff*on_u(i,j)
                 fac2=cff*om_u(i,j)
 #endif
-                cff=0.5_r8*(pn(i-1,j)+pn(i,j))
+                cff=pn_u(i,j)
                 dnUdz=cff*dUdz(i,j,k2)
                 dnVdz=cff*0.25_r8*(dVdz(i-1,j+1,k2)+                    &
      &                             dVdz(i  ,j+1,k2)+                    &
      &                             dVdz(i-1,j  ,k2)+                    &
      &                             dVdz(i  ,j  ,k2))
-                cff=0.5_r8*(pm(i-1,j)+pm(i,j))
+                cff=pm_u(i,j)
                 dmUdz=cff*dUdz(i,j,k2)
                 dmVdz=cff*0.25_r8*(dVdz(i-1,j+1,k2)+                    &
      &                             dVdz(i  ,j+1,k2)+                    &
@@ -618,13 +630,13 @@
                 fac1=cff*on_v(i,j)
                 fac2=cff*om_v(i,j)
 #endif
-                cff=0.5_r8*(pn(i,j-1)+pn(i,j))
+                cff=pn_v(i,j)
                 dnUdz=cff*0.25_r8*(dUdz(i  ,j  ,k2)+                    &
      &                             dUdz(i+1,j  ,k2)+                    &
      &                             dUdz(i  ,j-1,k2)+                    &
      &                             dUdz(i+1,j-1,k2))
                 dnVdz=cff*dVdz(i,j,k2)
-                cff=0.5_r8*(pm(i,j-1)+pm(i,j))
+                cff=pm_v(i,j)
                 dmUdz=cff*0.25_r8*(dUdz(i  ,j  ,k2)+                    &
      &                             dUdz(i+1,j  ,k2)+                    &
      &                             dUdz(i  ,j-1,k2)+                    &
@@ -694,9 +706,9 @@
 !
           DO j=Jstr,Jend
             DO i=IstrU,Iend
-              cff=dt(ng)*0.25_r8*(pm(i-1,j)+pm(i,j))*(pn(i-1,j)+pn(i,j))
-              cff1=0.5_r8*(pn(i-1,j)+pn(i,j))*(UFx(i,j  )-UFx(i-1,j))
-              cff2=0.5_r8*(pm(i-1,j)+pm(i,j))*(UFe(i,j+1)-UFe(i  ,j))
+              cff=dt(ng)*pm_u(i,j)*pn_u(i,j)
+              cff1=pn_u(i,j)*(UFx(i,j  )-UFx(i-1,j))
+              cff2=pm_u(i,j)*(UFe(i,j+1)-UFe(i  ,j))
               cff3=UFsx(i,j,k2)-UFsx(i,j,k1)
               cff4=UFse(i,j,k2)-UFse(i,j,k1)
               cff5=cff*(cff1+cff2)
@@ -717,9 +729,9 @@
 
           DO j=JstrV,Jend
             DO i=Istr,Iend
-              cff=dt(ng)*0.25_r8*(pm(i,j)+pm(i,j-1))*(pn(i,j)+pn(i,j-1))
-              cff1=0.5_r8*(pn(i,j-1)+pn(i,j))*(VFx(i+1,j)-VFx(i,j  ))
-              cff2=0.5_r8*(pm(i,j-1)+pm(i,j))*(VFe(i  ,j)-VFe(i,j-1))
+              cff=dt(ng)*pm_v(i,j)*pn_v(i,j)
+              cff1=pn_v(i,j)*(VFx(i+1,j)-VFx(i,j  ))
+              cff2=pm_v(i,j)*(VFe(i  ,j)-VFe(i,j-1))
               cff3=VFsx(i,j,k2)-VFsx(i,j,k1)
               cff4=VFse(i,j,k2)-VFse(i,j,k1)
               cff5=cff*(cff1-cff2)
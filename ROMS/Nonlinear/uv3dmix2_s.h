@@ -69,12 +69,22 @@
      &                    GRID(ng) % on_p,                              &
      &                    GRID(ng) % on_r,                              &
      &                    GRID(ng) % pm,                                &
+     &                    GRID(ng) % pm_u,                              &
+     &                    GRID(ng) % pm_v,                              &
      &                    GRID(ng) % pmon_p,                            &
      &                    GRID(ng) % pmon_r,                            &
      &                    GRID(ng) % pn,                                &
+     &                    GRID(ng) % pn_u,                              &
+     &                    GRID(ng) % pn_v,                              &
      &                    GRID(ng) % pnom_p,                            &
      &                    GRID(ng) % pnom_r,                            &
-#ifdef VISC_3DCOEF
+#if defined VISC_3DFUSED
+# ifdef MASKING
+     &                    GRID(ng) % rmask,                             &
+# endif
+     &                    GRID(ng) % omn,                               &
+     &                    MIXING(ng) % Hviscosity,                      &
+#elif defined VISC_3DCOEF
      &                    MIXING(ng) % visc3d_r,                        &
 #else
      &                    MIXING(ng) % visc2_p,                         &
@@ -109,9 +119,14 @@
 #endif
      &                          Hz,                                     &
      &                          om_p, om_r, on_p, on_r,                 &
-     &                          pm, pmon_p, pmon_r,                     &
-     &                          pn, pnom_p, pnom_r,                     &
-#ifdef VISC_3DCOEF
+     &                          pm, pm_u, pm_v, pmon_p, pmon_r,         &
+     &                          pn, pn_u, pn_v, pnom_p, pnom_r,         &
+#if defined VISC_3DFUSED
+# ifdef MASKING
+     &                          rmask,                                  &
+# endif
+     &                          omn, Hviscosity,                        &
+#elif defined VISC_3DCOEF
      &                          visc3d_r,                               &
 #else
      &                          visc2_p, visc2_r,                       &
@@ -125,6 +140,10 @@
 !
       USE mod_param
       USE mod_scalars
+#ifdef VISC_3DFUSED
+!
+      USE hmixing_mod, ONLY : hmixing_k
+#endif
 !
 !  Imported variable declarations.
 !
@@ -146,12 +165,22 @@
       real(r8), intent(in) :: on_p(LBi:,LBj:)
       real(r8), intent(in) :: on_r(LBi:,LBj:)
       real(r8), intent(in) :: pm(LBi:,LBj:)
+      real(r8), intent(in) :: pm_u(LBi:,LBj:)
+      real(r8), intent(in) :: pm_v(LBi:,LBj:)
       real(r8), intent(in) :: pmon_p(LBi:,LBj:)
       real(r8), intent(in) :: pmon_r(LBi:,LBj:)
       real(r8), intent(in) :: pn(LBi:,LBj:)
+      real(r8), intent(in) :: pn_u(LBi:,LBj:)
+      real(r8), intent(in) :: pn_v(LBi:,LBj:)
       real(r8), intent(in) :: pnom_p(LBi:,LBj:)
       real(r8), intent(in) :: pnom_r(LBi:,LBj:)
-# ifdef VISC_3DCOEF
+# if defined VISC_3DFUSED
+#  ifdef MASKING
+      real(r8), intent(in) :: rmask(LBi:,LBj:)
+#  endif
+      real(r8), intent(in) :: omn(LBi:,LBj:)
+      real(r8), intent(in) :: Hviscosity(LBi:,LBj:)
+# elif defined VISC_3DCOEF
       real(r8), intent(in) :: visc3d_r(LBi:,LBj:,:)
 # else
       real(r8), intent(in) :: visc2_p(LBi:,LBj:)
@@ -180,12 +209,22 @@
       real(r8), intent(in) :: on_p(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: on_r(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: pm(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pm_u(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pm_v(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: pmon_p(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: pmon_r(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: pn(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pn_u(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pn_v(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: pnom_p(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: pnom_r(LBi:UBi,LBj:UBj)
-# ifdef VISC_3DCOEF
+# if defined VISC_3DFUSED
+#  ifdef MASKING
+      real(r8), intent(in) :: rmask(LBi:UBi,LBj:UBj)
+#  endif
+      real(r8), intent(in) :: omn(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: Hviscosity(LBi:UBi,LBj:UBj)
+# elif defined VISC_3DCOEF
       real(r8), intent(in) :: visc3d_r(LBi:UBi,LBj:UBj,N(ng))
 # else
       real(r8), intent(in) :: visc2_p(LBi:UBi,LBj:UBj)
@@ -208,8 +247,11 @@
       integer :: i, j, k
 
       real(r8) :: cff, cff1, cff2, cff3
-#ifdef VISC_3DCOEF
+#if defined VISC_3DCOEF || defined VISC_3DFUSED
       real(r8) :: visc_p
+#endif
+#ifdef VISC_3DFUSED
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS) :: visc3d
 #endif
       real(r8), dimension(IminS:ImaxS,JminS:JmaxS) :: UFe
       real(r8), dimension(IminS:ImaxS,JminS:JmaxS) :: VFe
@@ -223,6 +265,20 @@
 !-----------------------------------------------------------------------
 !
       K_LOOP : DO k=1,N(ng)
+#ifdef VISC_3DFUSED
+!
+!  Compute Smagorinsky viscosity coefficient for this level.
+!
+        CALL hmixing_k (ng, tile, k,                                    &
+     &                  LBi, UBi, LBj, UBj,                             &
+     &                  IminS, ImaxS, JminS, JmaxS,                     &
+     &                  nrhs,                                           &
+# ifdef MASKING
+     &                  rmask,                                          &
+# endif
+     &                  pm, pn, omn, Hviscosity,                        &
+     &                  u, v, visc3d)
+#endif
 !
 !  Compute flux-components of the horizontal divergence of the stress
 !  tensor (m5/s2) in XI- and ETA-directions.
@@ -236,7 +292,10 @@
      &           pnom_r(i,j)*                                           &
      &           ((pm(i,j  )+pm(i,j+1))*v(i,j+1,k,nrhs)-                &
      &            (pm(i,j-1)+pm(i,j  ))*v(i,j  ,k,nrhs)))
-#ifdef VISC_3DCOEF
+#if defined VISC_3DFUSED
+            UFx(i,j)=on_r(i,j)*on_r(i,j)*visc3d(i,j)*cff
+            VFe(i,j)=om_r(i,j)*om_r(i,j)*visc3d(i,j)*cff
+#elif defined VISC_3DCOEF
             UFx(i,j)=on_r(i,j)*on_r(i,j)*visc3d_r(i,j,k)*cff
             VFe(i,j)=om_r(i,j)*om_r(i,j)*visc3d_r(i,j,k)*cff
 #else
@@ -261,7 +320,12 @@
 #ifdef WET_DRY
             cff=cff*pmask_wet(i,j)
 #endif
-#ifdef VISC_3DCOEF
+#if defined VISC_3DFUSED
+            visc_p=0.25_r8*(visc3d(i-1,j-1)+visc3d(i-1,j)+              &
+     &                      visc3d(i  ,j-1)+visc3d(i  ,j))
+            UFe(i,j)=om_p(i,j)*om_p(i,j)*visc_p*cff
+            VFx(i,j)=on_p(i,j)*on_p(i,j)*visc_p*cff
+#elif defined VISC_3DCOEF
             visc_p=0.25_r8*(visc3d_r(i-1,j-1,k)+visc3d_r(i-1,j,k)+      &
      &                      visc3d_r(i  ,j-1,k)+visc3d_r(i  ,j,k))
             UFe(i,j)=om_p(i,j)*om_p(i,j)*visc_p*cff
@@ -279,9 +343,9 @@
 !
         DO j=Jstr,Jend
           DO i=IstrU,Iend
-            cff=dt(ng)*0.25_r8*(pm(i-1,j)+pm(i,j))*(pn(i-1,j)+pn(i,j))
-            cff1=0.5_r8*(pn(i-1,j)+pn(i,j))*(UFx(i,j  )-UFx(i-1,j))
-            cff2=0.5_r8*(pm(i-1,j)+pm(i,j))*(UFe(i,j+1)-UFe(i  ,j))
+            cff=dt(ng)*pm_u(i,j)*pn_u(i,j)
+            cff1=pn_u(i,j)*(UFx(i,j  )-UFx(i-1,j))
+            cff2=pm_u(i,j)*(UFe(i,j+1)-UFe(i  ,j))
             cff3=cff*(cff1+cff2)
             rufrc(i,j)=rufrc(i,j)+cff1+cff2
             u(i,j,k,nnew)=u(i,j,k,nnew)+cff3
@@ -297,9 +361,9 @@
         END DO
         DO j=JstrV,Jend
           DO i=Istr,Iend
-            cff=dt(ng)*0.25_r8*(pm(i,j)+pm(i,j-1))*(pn(i,j)+pn(i,j-1))
-            cff1=0.5_r8*(pn(i,j-1)+pn(i,j))*(VFx(i+1,j)-VFx(i,j  ))
-            cff2=0.5_r8*(pm(i,j-1)+pm(i,j))*(VFe(i  ,j)-VFe(i,j-1))
+            cff=dt(ng)*pm_v(i,j)*pn_v(i,j)
+            cff1=pn_v(i,j)*(VFx(i+1,j)-VFx(i,j  ))
+            cff2=pm_v(i,j)*(VFe(i  ,j)-VFe(i,j-1))
             cff3=cff*(cff1-cff2)
             rvfrc(i,j)=rvfrc(i,j)+cff1-cff2
             v(i,j,k,nnew)=v(i,j,k,nnew)+cff3
@@ -78,7 +78,11 @@
      &                    GRID(ng) % on_u,                              &
      &                    GRID(ng) % on_v,                              &
      &                    GRID(ng) % pm,                                &
+     &                    GRID(ng) % pm_u,                              &
+     &                    GRID(ng) % pm_v,                              &
      &                    GRID(ng) % pn,                                &
+     &                    GRID(ng) % pn_u,                              &
+     &                    GRID(ng) % pn_v,                              &
      &                    GRID(ng) % Hz,                                &
      &                    GRID(ng) % z_r,                               &
 #ifdef VISC_3DCOEF
@@ -123,7 +127,7 @@
 #endif
      &                          om_p, om_r, om_u, om_v,                 &
      &                          on_p, on_r, on_u, on_v,                 &
-     &                          pm, pn,                                 &
+     &                          pm, pm_u, pm_v, pn, pn_u, pn_v,         &
      &                          Hz, z_r,                                &
 #ifdef VISC_3DCOEF
 # ifdef UV_U3ADV_SPLIT
@@ -175,7 +179,11 @@
       real(r8), intent(in) :: on_u(LBi:,LBj:)
       real(r8), intent(in) :: on_v(LBi:,LBj:)
       real(r8), intent(in) :: pm(LBi:,LBj:)
+      real(r8), intent(in) :: pm_u(LBi:,LBj:)
+      real(r8), intent(in) :: pm_v(LBi:,LBj:)
       real(r8), intent(in) :: pn(LBi:,LBj:)
+      real(r8), intent(in) :: pn_u(LBi:,LBj:)
+      real(r8), intent(in) :: pn_v(LBi:,LBj:)
       real(r8), intent(in) :: Hz(LBi:,LBj:,:)
       real(r8), intent(in) :: z_r(LBi:,LBj:,:)
 # ifdef VISC_3DCOEF
@@ -221,7 +229,11 @@
       real(r8), intent(in) :: on_u(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: on_v(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: pm(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pm_u(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pm_v(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: pn(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pn_u(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pn_v(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: Hz(LBi:UBi,LBj:UBj,N(ng))
       real(r8), intent(in) :: z_r(LBi:UBi,LBj:UBj,N(ng))
 # ifdef VISC_3DCOEF
@@ -249,7 +261,7 @@
 !
 !  Local variable declarations.
 !
-      integer :: i, j, k, k1, k2
+      integer :: i, j, k, kk, k1, k2, k3, k4, kw1, kw2
 
       real(r8) :: cff, fac1, fac2, pm_p, pn_p
       real(r8) :: cff1, cff2, cff3, cff4
@@ -259,28 +271,28 @@
       real(r8) :: Uvis_p, Vvis_p, visc_p
 #endif
 
-      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,N(ng)) :: LapU
-      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,N(ng)) :: LapV
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,3) :: LapU
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,3) :: LapV
 
       real(r8), dimension(IminS:ImaxS,JminS:JmaxS) :: UFe
       real(r8), dimension(IminS:ImaxS,JminS:JmaxS) :: UFx
       real(r8), dimension(IminS:ImaxS,JminS:JmaxS) :: VFe
       real(r8), dimension(IminS:ImaxS,JminS:JmaxS) :: VFx
 
-      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,2) :: UFse
-      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,2) :: UFsx
-      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,2) :: VFse
-      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,2) :: VFsx
-      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,2) :: dmUde
-      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,2) :: dmVde
-      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,2) :: dnUdx
-      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,2) :: dnVdx
-      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,2) :: dUdz
-      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,2) :: dVdz
-      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,2) :: dZde_p
-      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,2) :: dZde_r
-      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,2) :: dZdx_p
-      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,2) :: dZdx_r
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,4) :: UFse
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,4) :: UFsx
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,4) :: VFse
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,4) :: VFsx
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,4) :: dmUde
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,4) :: dmVde
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,4) :: dnUdx
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,4) :: dnVdx
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,4) :: dUdz
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,4) :: dVdz
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,3) :: dZde_p
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,3) :: dZde_r
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,3) :: dZdx_p
+      real(r8), dimension(IminS:ImaxS,JminS:JmaxS,3) :: dZdx_r
 
 #include "set_bounds.h"
 !
@@ -294,1117 +306,1060 @@
 !  blocking sequence. It is assumed here that the mixing coefficients
 !  are the squared root of the biharmonic viscosity coefficient. For
 !  momentum balance purposes, the thickness "Hz" appears only when
-!  computing the second harmonic operator. The vertical placement of
-!  the gradients is:
+!  computing the second harmonic operator.
 !
-!    dZdx_r, dZde_r, dnUdx, dmVde(:,:,k1) k      rho-points
-!    dZdx_r, dZde_r, dnUdx, dmVde(:,:,k2) k+1    rho-points
-!    dZdx_p, dZde_p, dnVdx, dmUde(:,:,k1) k      psi-points
-!    dZdx_p, dZde_p, dnVdx, dmUde(:,:,k2) k+1    psi-points
-!                UFse, UFsx, dUdz(:,:,k1) k-1/2  WU-points
-!                UFse, UFsx, dUdz(:,:,k2) k+1/2  WU-points
-!                VFse, VFsx, dVdz(:,:,k1) k-1/2  WV-points
-!                VFse, VFsx, dVdz(:,:,k2) k+1/2  WV-points
+!  Both harmonic operators are fused in a single vertical loop: the
+!  first operator is computed one level ahead of the second one, so
+!  "LapU", "LapV", and the slopes are only kept in a sliding window
+!  of three levels and the slopes are computed once for both. The
+!  vertical placement of the gradients is:
+!
+!               dZdx_r, dZde_r(:,:,kw1) k      rho-points
+!               dZdx_r, dZde_r(:,:,kw2) k+1    rho-points
+!               dZdx_p, dZde_p(:,:,kw1) k      psi-points
+!               dZdx_p, dZde_p(:,:,kw2) k+1    psi-points
+!                   LapU, LapV(:,:,kw1) k      U-, V-points
+!                   LapU, LapV(:,:,kw2) k+1    U-, V-points
+!           dnUdx, dmVde(:,:,k1) or k3) k      rho-points
+!           dnUdx, dmVde(:,:,k2) or k4) k+1    rho-points
+!           dnVdx, dmUde(:,:,k1) or k3) k      psi-points
+!           dnVdx, dmUde(:,:,k2) or k4) k+1    psi-points
+!       UFse, UFsx, dUdz(:,:,k1) or k3) k-1/2  WU-points
+!       UFse, UFsx, dUdz(:,:,k2) or k4) k+1/2  WU-points
+!       VFse, VFsx, dVdz(:,:,k1) or k3) k-1/2  WV-points
+!       VFse, VFsx, dVdz(:,:,k2) or k4) k+1/2  WV-points
+!
+!  where slots k1:k2 are used by the first operator and k3:k4 by the
+!  second one.
 !
       k2=1
-      K_LOOP1 : DO k=0,N(ng)
-        k1=k2
-        k2=3-k1
-        IF (k.lt.N(ng)) THEN
+      k4=3
+      K_LOOP : DO kk=0,N(ng)+1
+!
+!  Compute first harmonic operator at level "k", one level ahead of
+!  the second harmonic operator.
+!
+        k=kk
+        IF (k.le.N(ng)) THEN
+          k1=k2
+          k2=3-k1
+          kw1=MOD(k,3)+1
+          kw2=MOD(k+1,3)+1
+          IF (k.lt.N(ng)) THEN
 !
 !  Compute slopes (nondimensional) at RHO- and PSI-points.
 !
-          DO j=Jstrm2,Jendp2
-            DO i=IstrUm2,Iendp2
-              cff=0.5_r8*(pm(i-1,j)+pm(i,j))
+            DO j=Jstrm2,Jendp2
+              DO i=IstrUm2,Iendp2
+                cff=pm_u(i,j)
 #ifdef MASKING
-              cff=cff*umask(i,j)
+                cff=cff*umask(i,j)
 #endif
 #ifdef WET_DRY
-              cff=cff*umask_wet(i,j)
+                cff=cff*umask_wet(i,j)
 #endif
-              UFx(i,j)=cff*(z_r(i  ,j,k+1)-                             &
-     &                      z_r(i-1,j,k+1))
+                UFx(i,j)=cff*(z_r(i  ,j,k+1)-                           &
+     &                        z_r(i-1,j,k+1))
+              END DO
             END DO
-          END DO
-          DO j=JstrVm2,Jendp2
-            DO i=Istrm2,Iendp2
-              cff=0.5_r8*(pn(i,j-1)+pn(i,j))
+            DO j=JstrVm2,Jendp2
+              DO i=Istrm2,Iendp2
+                cff=pn_v(i,j)
 #ifdef MASKING
-              cff=cff*vmask(i,j)
+                cff=cff*vmask(i,j)
 #endif
 #ifdef WET_DRY
-              cff=cff*vmask_wet(i,j)
+                cff=cff*vmask_wet(i,j)
 #endif
-              VFe(i,j)=cff*(z_r(i,j  ,k+1)-                             &
-     &                      z_r(i,j-1,k+1))
+                VFe(i,j)=cff*(z_r(i,j  ,k+1)-                           &
+     &                        z_r(i,j-1,k+1))
+              END DO
             END DO
-          END DO
 !
-          DO j=Jstrm1,Jendp2
-            DO i=Istrm1,Iendp2
-              dZdx_p(i,j,k2)=0.5_r8*(UFx(i,j-1)+                        &
-     &                               UFx(i,j  ))
-              dZde_p(i,j,k2)=0.5_r8*(VFe(i-1,j)+                        &
-     &                               VFe(i  ,j))
+            DO j=Jstrm1,Jendp2
+              DO i=Istrm1,Iendp2
+                dZdx_p(i,j,kw2)=0.5_r8*(UFx(i,j-1)+                     &
+     &                                 UFx(i,j  ))
+                dZde_p(i,j,kw2)=0.5_r8*(VFe(i-1,j)+                     &
+     &                                 VFe(i  ,j))
+              END DO
             END DO
-          END DO
-          DO j=JstrVm2,Jendp1
-            DO i=IstrUm2,Iendp1
-              dZdx_r(i,j,k2)=0.5_r8*(UFx(i  ,j)+                        &
-     &                               UFx(i+1,j))
-              dZde_r(i,j,k2)=0.5_r8*(VFe(i,j  )+                        &
-     &                               VFe(i,j+1))
+            DO j=JstrVm2,Jendp1
+              DO i=IstrUm2,Iendp1
+                dZdx_r(i,j,kw2)=0.5_r8*(UFx(i  ,j)+                     &
+     &                                 UFx(i+1,j))
+                dZde_r(i,j,kw2)=0.5_r8*(VFe(i,j  )+                     &
+     &                                 VFe(i,j+1))
+              END DO
             END DO
-          END DO
 !
 !  Compute momentum horizontal (1/m/s) and vertical (1/s) gradients.
 !
-          DO j=JstrVm2,Jendp1
-            DO i=IstrUm2,Iendp1
-              cff=0.5_r8*pm(i,j)
+            DO j=JstrVm2,Jendp1
+              DO i=IstrUm2,Iendp1
+                cff=0.5_r8*pm(i,j)
 #ifdef MASKING
-              cff=cff*rmask(i,j)
+                cff=cff*rmask(i,j)
 #endif
 #ifdef WET_DRY
-              cff=cff*rmask_wet(i,j)
+                cff=cff*rmask_wet(i,j)
 #endif
-              dnUdx(i,j,k2)=cff*((pn(i  ,j)+pn(i+1,j))*                 &
-     &                           u(i+1,j,k+1,nrhs)-                     &
-     &                           (pn(i-1,j)+pn(i  ,j))*                 &
-     &                           u(i  ,j,k+1,nrhs))
+                dnUdx(i,j,k2)=cff*((pn(i  ,j)+pn(i+1,j))*               &
+     &                             u(i+1,j,k+1,nrhs)-                   &
+     &                             (pn(i-1,j)+pn(i  ,j))*               &
+     &                             u(i  ,j,k+1,nrhs))
+              END DO
             END DO
-          END DO
 
-          DO j=Jstrm1,Jendp2
-            DO i=Istrm1,Iendp2
-              cff=0.125_r8*(pn(i-1,j  )+pn(i,j  )+                      &
-     &                      pn(i-1,j-1)+pn(i,j-1))
+            DO j=Jstrm1,Jendp2
+              DO i=Istrm1,Iendp2
+                cff=0.125_r8*(pn(i-1,j  )+pn(i,j  )+                    &
+     &                        pn(i-1,j-1)+pn(i,j-1))
 #ifdef MASKING
-              cff=cff*pmask(i,j)
+                cff=cff*pmask(i,j)
 #endif
 #ifdef WET_DRY
-              cff=cff*pmask_wet(i,j)
+                cff=cff*pmask_wet(i,j)
 #endif
-              dmUde(i,j,k2)=cff*((pm(i-1,j  )+pm(i,j  ))*               &
-     &                           u(i,j  ,k+1,nrhs)-                     &
-     &                           (pm(i-1,j-1)+pm(i,j-1))*               &
-     &                           u(i,j-1,k+1,nrhs))
+                dmUde(i,j,k2)=cff*((pm(i-1,j  )+pm(i,j  ))*             &
+     &                             u(i,j  ,k+1,nrhs)-                   &
+     &                             (pm(i-1,j-1)+pm(i,j-1))*             &
+     &                             u(i,j-1,k+1,nrhs))
+              END DO
             END DO
-          END DO
 
-          DO j=Jstrm1,Jendp2
-            DO i=Istrm1,Iendp2
-              cff=0.125_r8*(pm(i-1,j  )+pm(i,j  )+                      &
-     &                      pm(i-1,j-1)+pm(i,j-1))
+            DO j=Jstrm1,Jendp2
+              DO i=Istrm1,Iendp2
+                cff=0.125_r8*(pm(i-1,j  )+pm(i,j  )+                    &
+     &                        pm(i-1,j-1)+pm(i,j-1))
 #ifdef MASKING
-              cff=cff*pmask(i,j)
+                cff=cff*pmask(i,j)
 #endif
 #ifdef WET_DRY
-              cff=cff*pmask_wet(i,j)
+                cff=cff*pmask_wet(i,j)
 #endif
-              dnVdx(i,j,k2)=cff*((pn(i  ,j-1)+pn(i  ,j))*               &
-     &                           v(i  ,j,k+1,nrhs)-                     &
-     &                           (pn(i-1,j-1)+pn(i-1,j))*               &
-     &                           v(i-1,j,k+1,nrhs))
+                dnVdx(i,j,k2)=cff*((pn(i  ,j-1)+pn(i  ,j))*             &
+     &                             v(i  ,j,k+1,nrhs)-                   &
+     &                             (pn(i-1,j-1)+pn(i-1,j))*             &
+     &                             v(i-1,j,k+1,nrhs))
+              END DO
             END DO
-          END DO
 
-          DO j=JstrVm2,Jendp1
-            DO i=IstrUm2,Iendp1
-              cff=0.5_r8*pn(i,j)
+            DO j=JstrVm2,Jendp1
+              DO i=IstrUm2,Iendp1
+                cff=0.5_r8*pn(i,j)
 #ifdef MASKING
-              cff=cff*rmask(i,j)
+                cff=cff*rmask(i,j)
 #endif
 #ifdef WET_DRY
-              cff=cff*rmask_wet(i,j)
+                cff=cff*rmask_wet(i,j)
 #endif
-              dmVde(i,j,k2)=cff*((pm(i,j  )+pm(i,j+1))*                 &
-     &                           v(i,j+1,k+1,nrhs)-                     &
-     &                           (pm(i,j-1)+pm(i,j  ))*                 &
-     &                           v(i,j  ,k+1,nrhs))
+                dmVde(i,j,k2)=cff*((pm(i,j  )+pm(i,j+1))*               &
+     &                             v(i,j+1,k+1,nrhs)-                   &
+     &                             (pm(i,j-1)+pm(i,j  ))*               &
+     &                             v(i,j  ,k+1,nrhs))
+              END DO
             END DO
-          END DO
-        END IF
+          END IF
 
-        IF ((k.eq.0).or.(k.eq.N(ng))) THEN
-          DO j=Jstrm2,Jendp2
-            DO i=IstrUm2,Iendp2
-              dUdz(i,j,k2)=0.0_r8
+          IF ((k.eq.0).or.(k.eq.N(ng))) THEN
+            DO j=Jstrm2,Jendp2
+              DO i=IstrUm2,Iendp2
+                dUdz(i,j,k2)=0.0_r8
+              END DO
             END DO
-          END DO
-          DO j=JstrVm2,Jendp2
-            DO i=Istrm2,Iendp2
-              dVdz(i,j,k2)=0.0_r8
+            DO j=JstrVm2,Jendp2
+              DO i=Istrm2,Iendp2
+                dVdz(i,j,k2)=0.0_r8
+              END DO
             END DO
-          END DO
 
-          DO j=Jstrm1,Jendp1
-            DO i=IstrUm1,Iendp1
-              UFsx(i,j,k2)=0.0_r8
-              UFse(i,j,k2)=0.0_r8
+            DO j=Jstrm1,Jendp1
+              DO i=IstrUm1,Iendp1
+                UFsx(i,j,k2)=0.0_r8
+                UFse(i,j,k2)=0.0_r8
+              END DO
             END DO
-          END DO
-          DO j=JstrVm1,Jendp1
-            DO i=Istrm1,Iendp1
-              VFsx(i,j,k2)=0.0_r8
-              VFse(i,j,k2)=0.0_r8
+            DO j=JstrVm1,Jendp1
+              DO i=Istrm1,Iendp1
+                VFsx(i,j,k2)=0.0_r8
+                VFse(i,j,k2)=0.0_r8
+              END DO
             END DO
-          END DO
-        ELSE
-          DO j=Jstrm2,Jendp2
-            DO i=IstrUm2,Iendp2
-              cff=1.0_r8/(0.5_r8*(z_r(i-1,j,k+1)-                       &
-     &                            z_r(i-1,j,k  )+                       &
-     &                            z_r(i  ,j,k+1)-                       &
-     &                            z_r(i  ,j,k  )))
-              dUdz(i,j,k2)=cff*(u(i,j,k+1,nrhs)-                        &
-     &                          u(i,j,k  ,nrhs))
+          ELSE
+            DO j=Jstrm2,Jendp2
+              DO i=IstrUm2,Iendp2
+                cff=1.0_r8/(0.5_r8*(z_r(i-1,j,k+1)-                     &
+     &                              z_r(i-1,j,k  )+                     &
+     &                              z_r(i  ,j,k+1)-                     &
+     &                              z_r(i  ,j,k  )))
+                dUdz(i,j,k2)=cff*(u(i,j,k+1,nrhs)-                      &
+     &                            u(i,j,k  ,nrhs))
+              END DO
             END DO
-          END DO
 
-          DO j=JstrVm2,Jendp2
-            DO i=Istrm2,Iendp2
-              cff=1.0_r8/(0.5_r8*(z_r(i,j-1,k+1)-                       &
-     &                            z_r(i,j-1,k  )+                       &
-     &                            z_r(i,j  ,k+1)-                       &
-     &                            z_r(i,j  ,k  )))
-              dVdz(i,j,k2)=cff*(v(i,j,k+1,nrhs)-                        &
-     &                          v(i,j,k  ,nrhs))
+            DO j=JstrVm2,Jendp2
+              DO i=Istrm2,Iendp2
+                cff=1.0_r8/(0.5_r8*(z_r(i,j-1,k+1)-                     &
+     &                              z_r(i,j-1,k  )+                     &
+     &                              z_r(i,j  ,k+1)-                     &
+     &                              z_r(i,j  ,k  )))
+                dVdz(i,j,k2)=cff*(v(i,j,k+1,nrhs)-                      &
+     &                            v(i,j,k  ,nrhs))
+              END DO
             END DO
-          END DO
-        END IF
+          END IF
 !
 !  Compute components of the rotated viscous flux (m^4 s-^3/2) along
 !  geopotential surfaces in the XI- and ETA-directions.
 !
-        IF (k.gt.0) THEN
-          DO j=JstrVm2,Jendp1
-            DO i=IstrUm2,Iendp1
-              cff1=MIN(dZdx_r(i,j,k1),0.0_r8)
-              cff2=MAX(dZdx_r(i,j,k1),0.0_r8)
-              cff3=MIN(dZde_r(i,j,k1),0.0_r8)
-              cff4=MAX(dZde_r(i,j,k1),0.0_r8)
-              cff=on_r(i,j)*(dnUdx(i,j,k1)-                             &
-     &                       0.5_r8*pn(i,j)*                            &
-     &                       (cff1*(dUdz(i  ,j,k1)+                     &
-     &                              dUdz(i+1,j,k2))+                    &
-     &                        cff2*(dUdz(i  ,j,k2)+                     &
-     &                              dUdz(i+1,j,k1))))-                  &
-     &            om_r(i,j)*(dmVde(i,j,k1)-                             &
-     &                       0.5_r8*pm(i,j)*                            &
-     &                       (cff3*(dVdz(i,j  ,k1)+                     &
-     &                              dVdz(i,j+1,k2))+                    &
-     &                        cff4*(dVdz(i,j  ,k2)+                     &
-     &                              dVdz(i,j+1,k1))))
+          IF (k.gt.0) THEN
+            DO j=JstrVm2,Jendp1
+              DO i=IstrUm2,Iendp1
+                cff1=MIN(dZdx_r(i,j,kw1),0.0_r8)
+                cff2=MAX(dZdx_r(i,j,kw1),0.0_r8)
+                cff3=MIN(dZde_r(i,j,kw1),0.0_r8)
+                cff4=MAX(dZde_r(i,j,kw1),0.0_r8)
+                cff=on_r(i,j)*(dnUdx(i,j,k1)-                           &
+     &                         0.5_r8*pn(i,j)*                          &
+     &                         (cff1*(dUdz(i  ,j,k1)+                   &
+     &                                dUdz(i+1,j,k2))+                  &
+     &                          cff2*(dUdz(i  ,j,k2)+                   &
+     &                                dUdz(i+1,j,k1))))-                &
+     &              om_r(i,j)*(dmVde(i,j,k1)-                           &
+     &                         0.5_r8*pm(i,j)*                          &
+     &                         (cff3*(dVdz(i,j  ,k1)+                   &
+     &                                dVdz(i,j+1,k2))+                  &
+     &                          cff4*(dVdz(i,j  ,k2)+                   &
+     &                                dVdz(i,j+1,k1))))
 #ifdef MASKING
-              cff=cff*rmask(i,j)
+                cff=cff*rmask(i,j)
 #endif
 #ifdef WET_DRY
-              cff=cff*rmask_wet(i,j)
+                cff=cff*rmask_wet(i,j)
 #endif
 #ifdef VISC_3DCOEF
 # ifdef UV_U3ADV_SPLIT
-              UFx(i,j)=on_r(i,j)*on_r(i,j)*Uvis3d_r(i,j,k)*cff
-              VFe(i,j)=om_r(i,j)*om_r(i,j)*Vvis3d_r(i,j,k)*cff
+                UFx(i,j)=on_r(i,j)*on_r(i,j)*Uvis3d_r(i,j,k)*cff
+                VFe(i,j)=om_r(i,j)*om_r(i,j)*Vvis3d_r(i,j,k)*cff
 # else
-              UFx(i,j)=on_r(i,j)*on_r(i,j)*visc3d_r(i,j,k)*cff
-              VFe(i,j)=om_r(i,j)*om_r(i,j)*visc3d_r(i,j,k)*cff
+                UFx(i,j)=on_r(i,j)*on_r(i,j)*visc3d_r(i,j,k)*cff
+                VFe(i,j)=om_r(i,j)*om_r(i,j)*visc3d_r(i,j,k)*cff
 # endif
 #else
-              UFx(i,j)=on_r(i,j)*on_r(i,j)*visc4_r(i,j)*cff
-              VFe(i,j)=om_r(i,j)*om_r(i,j)*visc4_r(i,j)*cff
+                UFx(i,j)=on_r(i,j)*on_r(i,j)*visc4_r(i,j)*cff
+                VFe(i,j)=om_r(i,j)*om_r(i,j)*visc4_r(i,j)*cff
 #endif
+              END DO
             END DO
-          END DO
 
-          DO j=Jstrm1,Jendp2
-            DO i=Istrm1,Iendp2
-              pm_p=0.25_r8*(pm(i-1,j-1)+pm(i-1,j)+                      &
-     &                      pm(i  ,j-1)+pm(i  ,j))
-              pn_p=0.25_r8*(pn(i-1,j-1)+pn(i-1,j)+                      &
-     &                      pn(i  ,j-1)+pn(i  ,j))
-              cff1=MIN(dZdx_p(i,j,k1),0.0_r8)
-              cff2=MAX(dZdx_p(i,j,k1),0.0_r8)
-              cff3=MIN(dZde_p(i,j,k1),0.0_r8)
-              cff4=MAX(dZde_p(i,j,k1),0.0_r8)
-              cff=on_p(i,j)*(dnVdx(i,j,k1)-                             &
-     &                       0.5_r8*pn_p*                               &
-     &                       (cff1*(dVdz(i-1,j,k1)+                     &
-     &                              dVdz(i  ,j,k2))+                    &
-     &                        cff2*(dVdz(i-1,j,k2)+                     &
-     &                              dVdz(i  ,j,k1))))+                  &
-     &            om_p(i,j)*(dmUde(i,j,k1)-                             &
-     &                       0.5_r8*pm_p*                               &
-     &                       (cff3*(dUdz(i,j-1,k1)+                     &
-     &                              dUdz(i,j  ,k2))+                    &
-     &                        cff4*(dUdz(i,j-1,k2)+                     &
-     &                              dUdz(i,j  ,k1))))
+            DO j=Jstrm1,Jendp2
+              DO i=Istrm1,Iendp2
+                pm_p=0.25_r8*(pm(i-1,j-1)+pm(i-1,j)+                    &
+     &                        pm(i  ,j-1)+pm(i  ,j))
+                pn_p=0.25_r8*(pn(i-1,j-1)+pn(i-1,j)+                    &
+     &                        pn(i  ,j-1)+pn(i  ,j))
+                cff1=MIN(dZdx_p(i,j,kw1),0.0_r8)
+                cff2=MAX(dZdx_p(i,j,kw1),0.0_r8)
+                cff3=MIN(dZde_p(i,j,kw1),0.0_r8)
+                cff4=MAX(dZde_p(i,j,kw1),0.0_r8)
+                cff=on_p(i,j)*(dnVdx(i,j,k1)-                           &
+     &                         0.5_r8*pn_p*                             &
+     &                         (cff1*(dVdz(i-1,j,k1)+                   &
+     &                                dVdz(i  ,j,k2))+                  &
+     &                          cff2*(dVdz(i-1,j,k2)+                   &
+     &                                dVdz(i  ,j,k1))))+                &
+     &              om_p(i,j)*(dmUde(i,j,k1)-                           &
+     &                         0.5_r8*pm_p*                             &
+     &                         (cff3*(dUdz(i,j-1,k1)+                   &
+     &                                dUdz(i,j  ,k2))+                  &
+     &                          cff4*(dUdz(i,j-1,k2)+                   &
+     &                                dUdz(i,j  ,k1))))
 #ifdef MASKING
-              cff=cff*pmask(i,j)
+                cff=cff*pmask(i,j)
 #endif
 #ifdef WET_DRY
-              cff=cff*pmask_wet(i,j)
+                cff=cff*pmask_wet(i,j)
 #endif
 #ifdef VISC_3DCOEF
 # ifdef UV_U3ADV_SPLIT
-              Uvis_p=0.25_r8*                                           &
-     &               (Uvis3d_r(i-1,j-1,k)+Uvis3d_r(i-1,j,k)+            &
-     &                Uvis3d_r(i  ,j-1,k)+Uvis3d_r(i  ,j,k))
-              Vvis_p=0.25_r8*                                           &
-     &               (Vvis3d_r(i-1,j-1,k)+Vvis3d_r(i-1,j,k)+            &
-     &                Vvis3d_r(i  ,j-1,k)+Vvis3d_r(i  ,j,k))
-              UFe(i,j)=om_p(i,j)*om_p(i,j)*Uvis_p*cff
-              VFx(i,j)=on_p(i,j)*on_p(i,j)*Vvis_p*cff
+                Uvis_p=0.25_r8*                                         &
+     &                 (Uvis3d_r(i-1,j-1,k)+Uvis3d_r(i-1,j,k)+          &
+     &                  Uvis3d_r(i  ,j-1,k)+Uvis3d_r(i  ,j,k))
+                Vvis_p=0.25_r8*                                         &
+     &                 (Vvis3d_r(i-1,j-1,k)+Vvis3d_r(i-1,j,k)+          &
+     &                  Vvis3d_r(i  ,j-1,k)+Vvis3d_r(i  ,j,k))
+                UFe(i,j)=om_p(i,j)*om_p(i,j)*Uvis_p*cff
+                VFx(i,j)=on_p(i,j)*on_p(i,j)*Vvis_p*cff
 # else
-              visc_p=0.25_r8*                                           &
-     &               (visc3d_r(i-1,j-1,k)+visc3d_r(i-1,j,k)+            &
-     &                visc3d_r(i  ,j-1,k)+visc3d_r(i  ,j,k))
-              UFe(i,j)=om_p(i,j)*om_p(i,j)*visc_p*cff
-              VFx(i,j)=on_p(i,j)*on_p(i,j)*visc_p*cff
+                visc_p=0.25_r8*                                         &
+     &                 (visc3d_r(i-1,j-1,k)+visc3d_r(i-1,j,k)+          &
+     &                  visc3d_r(i  ,j-1,k)+visc3d_r(i  ,j,k))
+                UFe(i,j)=om_p(i,j)*om_p(i,j)*visc_p*cff
+                VFx(i,j)=on_p(i,j)*on_p(i,j)*visc_p*cff
 # endif
 #else
-              UFe(i,j)=om_p(i,j)*om_p(i,j)*visc4_p(i,j)*cff
-              VFx(i,j)=on_p(i,j)*on_p(i,j)*visc4_p(i,j)*cff
+                UFe(i,j)=om_p(i,j)*om_p(i,j)*visc4_p(i,j)*cff
+                VFx(i,j)=on_p(i,j)*on_p(i,j)*visc4_p(i,j)*cff
 #endif
+              END DO
             END DO
-          END DO
 !
 !  Compute vertical flux (m^2 s^-3/2) due to sloping terrain-following
 !  surfaces.
 !
-          IF (k.lt.N(ng)) THEN
-            DO j=Jstrm1,Jendp1
-              DO i=IstrUm1,Iendp1
+            IF (k.lt.N(ng)) THEN
+              DO j=Jstrm1,Jendp1
+                DO i=IstrUm1,Iendp1
 #ifdef VISC_3DCOEF
 # ifdef UV_U3ADV_SPLIT
-                cff=0.125_r8*                                           &
-     &              (Uvis3d_r(i-1,j,k  )+Uvis3d_r(i,j,k  )+             &
-     &               Uvis3d_r(i-1,j,k+1)+Uvis3d_r(i,j,k+1))
+                  cff=0.125_r8*                                         &
+     &                (Uvis3d_r(i-1,j,k  )+Uvis3d_r(i,j,k  )+           &
+     &                 Uvis3d_r(i-1,j,k+1)+Uvis3d_r(i,j,k+1))
 # else
-                cff=0.125_r8*                                           &
-     &              (visc3d_r(i-1,j,k  )+visc3d_r(i,j,k  )+             &
-     &               visc3d_r(i-1,j,k+1)+visc3d_r(i,j,k+1))
+                  cff=0.125_r8*                                         &
+     &                (visc3d_r(i-1,j,k  )+visc3d_r(i,j,k  )+           &
+     &                 visc3d_r(i-1,j,k+1)+visc3d_r(i,j,k+1))
 # endif
-                fac1=cff*on_u(i,j)
-                fac2=cff*om_u(i,j)
+                  fac1=cff*on_u(i,j)
+                  fac2=cff*om_u(i,j)
 #else
-                cff=0.25_r8*(visc4_r(i-1,j)+visc4_r(i,j))
-                fac1=cff*on_u(i,j)
-                fac2=cff*om_u(i,j)
+                  cff=0.25_r8*(visc4_r(i-1,j)+visc4_r(i,j))
+                  fac1=cff*on_u(i,j)
+                  fac2=cff*om_u(i,j)
 #endif
-                cff=0.5_r8*(pn(i-1,j)+pn(i,j))
-                dnUdz=cff*dUdz(i,j,k2)
-                dnVdz=cff*0.25_r8*(dVdz(i-1,j+1,k2)+                    &
-     &                             dVdz(i  ,j+1,k2)+                    &
-     &                             dVdz(i-1,j  ,k2)+                    &
-     &                             dVdz(i  ,j  ,k2))
-                cff=0.5_r8*(pm(i-1,j)+pm(i,j))
-                dmUdz=cff*dUdz(i,j,k2)
-                dmVdz=cff*0.25_r8*(dVdz(i-1,j+1,k2)+                    &
-     &                             dVdz(i  ,j+1,k2)+                    &
-     &                             dVdz(i-1,j  ,k2)+                    &
-     &                             dVdz(i  ,j  ,k2))
+                  cff=pn_u(i,j)
+                  dnUdz=cff*dUdz(i,j,k2)
+                  dnVdz=cff*0.25_r8*(dVdz(i-1,j+1,k2)+                  &
+     &                               dVdz(i  ,j+1,k2)+                  &
+     &                               dVdz(i-1,j  ,k2)+                  &
+     &                               dVdz(i  ,j  ,k2))
+                  cff=pm_u(i,j)
+                  dmUdz=cff*dUdz(i,j,k2)
+                  dmVdz=cff*0.25_r8*(dVdz(i-1,j+1,k2)+                  &
+     &                               dVdz(i  ,j+1,k2)+                  &
+     &                               dVdz(i-1,j  ,k2)+                  &
+     &                               dVdz(i  ,j  ,k2))
 
-                cff1=MIN(dZdx_r(i-1,j,k1),0.0_r8)
-                cff2=MIN(dZdx_r(i  ,j,k2),0.0_r8)
-                cff3=MAX(dZdx_r(i-1,j,k2),0.0_r8)
-                cff4=MAX(dZdx_r(i  ,j,k1),0.0_r8)
-                UFsx(i,j,k2)=fac1*                                      &
-     &                       (cff1*(cff1*dnUdz-dnUdx(i-1,j,k1))+        &
-     &                        cff2*(cff2*dnUdz-dnUdx(i  ,j,k2))+        &
-     &                        cff3*(cff3*dnUdz-dnUdx(i-1,j,k2))+        &
-     &                        cff4*(cff4*dnUdz-dnUdx(i  ,j,k1)))
+                  cff1=MIN(dZdx_r(i-1,j,kw1),0.0_r8)
+                  cff2=MIN(dZdx_r(i  ,j,kw2),0.0_r8)
+                  cff3=MAX(dZdx_r(i-1,j,kw2),0.0_r8)
+                  cff4=MAX(dZdx_r(i  ,j,kw1),0.0_r8)
+                  UFsx(i,j,k2)=fac1*                                    &
+     &                         (cff1*(cff1*dnUdz-dnUdx(i-1,j,k1))+      &
+     &                          cff2*(cff2*dnUdz-dnUdx(i  ,j,k2))+      &
+     &                          cff3*(cff3*dnUdz-dnUdx(i-1,j,k2))+      &
+     &                          cff4*(cff4*dnUdz-dnUdx(i  ,j,k1)))
 
-                cff1=MIN(dZde_p(i,j  ,k1),0.0_r8)
-                cff2=MIN(dZde_p(i,j+1,k2),0.0_r8)
-                cff3=MAX(dZde_p(i,j  ,k2),0.0_r8)
-                cff4=MAX(dZde_p(i,j+1,k1),0.0_r8)
-                UFse(i,j,k2)=fac2*                                      &
-     &                       (cff1*(cff1*dmUdz-dmUde(i,j  ,k1))+        &
-     &                        cff2*(cff2*dmUdz-dmUde(i,j+1,k2))+        &
-     &                        cff3*(cff3*dmUdz-dmUde(i,j  ,k2))+        &
-     &                        cff4*(cff4*dmUdz-dmUde(i,j+1,k1)))
+                  cff1=MIN(dZde_p(i,j  ,kw1),0.0_r8)
+                  cff2=MIN(dZde_p(i,j+1,kw2),0.0_r8)
+                  cff3=MAX(dZde_p(i,j  ,kw2),0.0_r8)
+                  cff4=MAX(dZde_p(i,j+1,kw1),0.0_r8)
+                  UFse(i,j,k2)=fac2*                                    &
+     &                         (cff1*(cff1*dmUdz-dmUde(i,j  ,k1))+      &
+     &                          cff2*(cff2*dmUdz-dmUde(i,j+1,k2))+      &
+     &                          cff3*(cff3*dmUdz-dmUde(i,j  ,k2))+      &
+     &                          cff4*(cff4*dmUdz-dmUde(i,j+1,k1)))
 
-                cff1=MIN(dZde_p(i,j  ,k1),0.0_r8)
-                cff2=MIN(dZde_p(i,j+1,k2),0.0_r8)
-                cff3=MAX(dZde_p(i,j  ,k2),0.0_r8)
-                cff4=MAX(dZde_p(i,j+1,k1),0.0_r8)
-                cff5=MIN(dZdx_p(i,j  ,k1),0.0_r8)
-                cff6=MIN(dZdx_p(i,j+1,k2),0.0_r8)
-                cff7=MAX(dZdx_p(i,j  ,k2),0.0_r8)
-                cff8=MAX(dZdx_p(i,j+1,k1),0.0_r8)
-                UFsx(i,j,k2)=UFsx(i,j,k2)+                              &
-     &                       fac1*                                      &
-     &                       (cff1*(cff5*dnVdz-dnVdx(i,j  ,k1))+        &
-     &                        cff2*(cff6*dnVdz-dnVdx(i,j+1,k2))+        &
-     &                        cff3*(cff7*dnVdz-dnVdx(i,j  ,k2))+        &
-     &                        cff4*(cff8*dnVdz-dnVdx(i,j+1,k1)))
+                  cff1=MIN(dZde_p(i,j  ,kw1),0.0_r8)
+                  cff2=MIN(dZde_p(i,j+1,kw2),0.0_r8)
+                  cff3=MAX(dZde_p(i,j  ,kw2),0.0_r8)
+                  cff4=MAX(dZde_p(i,j+1,kw1),0.0_r8)
+                  cff5=MIN(dZdx_p(i,j  ,kw1),0.0_r8)
+                  cff6=MIN(dZdx_p(i,j+1,kw2),0.0_r8)
+                  cff7=MAX(dZdx_p(i,j  ,kw2),0.0_r8)
+                  cff8=MAX(dZdx_p(i,j+1,kw1),0.0_r8)
+                  UFsx(i,j,k2)=UFsx(i,j,k2)+                            &
+     &                         fac1*                                    &
+     &                         (cff1*(cff5*dnVdz-dnVdx(i,j  ,k1))+      &
+     &                          cff2*(cff6*dnVdz-dnVdx(i,j+1,k2))+      &
+     &                          cff3*(cff7*dnVdz-dnVdx(i,j  ,k2))+      &
+     &                          cff4*(cff8*dnVdz-dnVdx(i,j+1,k1)))
 
-                cff1=MIN(dZdx_r(i-1,j,k1),0.0_r8)
-                cff2=MIN(dZdx_r(i  ,j,k2),0.0_r8)
-                cff3=MAX(dZdx_r(i-1,j,k2),0.0_r8)
-                cff4=MAX(dZdx_r(i  ,j,k1),0.0_r8)
-                cff5=MIN(dZde_r(i-1,j,k1),0.0_r8)
-                cff6=MIN(dZde_r(i  ,j,k2),0.0_r8)
-                cff7=MAX(dZde_r(i-1,j,k2),0.0_r8)
-                cff8=MAX(dZde_r(i  ,j,k1),0.0_r8)
-                UFse(i,j,k2)=UFse(i,j,k2)-                              &
-     &                       fac2*                                      &
-     &                       (cff1*(cff5*dmVdz-dmVde(i-1,j,k1))+        &
-     &                        cff2*(cff6*dmVdz-dmVde(i  ,j,k2))+        &
-     &                        cff3*(cff7*dmVdz-dmVde(i-1,j,k2))+        &
-     &                        cff4*(cff8*dmVdz-dmVde(i  ,j,k1)))
+                  cff1=MIN(dZdx_r(i-1,j,kw1),0.0_r8)
+                  cff2=MIN(dZdx_r(i  ,j,kw2),0.0_r8)
+                  cff3=MAX(dZdx_r(i-1,j,kw2),0.0_r8)
+                  cff4=MAX(dZdx_r(i  ,j,kw1),0.0_r8)
+                  cff5=MIN(dZde_r(i-1,j,kw1),0.0_r8)
+                  cff6=MIN(dZde_r(i  ,j,kw2),0.0_r8)
+                  cff7=MAX(dZde_r(i-1,j,kw2),0.0_r8)
+                  cff8=MAX(dZde_r(i  ,j,kw1),0.0_r8)
+                  UFse(i,j,k2)=UFse(i,j,k2)-                            &
+     &                         fac2*                                    &
+     &                         (cff1*(cff5*dmVdz-dmVde(i-1,j,k1))+      &
+     &                          cff2*(cff6*dmVdz-dmVde(i  ,j,k2))+      &
+     &                          cff3*(cff7*dmVdz-dmVde(i-1,j,k2))+      &
+     &                          cff4*(cff8*dmVdz-dmVde(i  ,j,k1)))
+                END DO
               END DO
-            END DO
 !
-            DO j=JstrVm1,Jendp1
-              DO i=Istrm1,Iendp1
+              DO j=JstrVm1,Jendp1
+                DO i=Istrm1,Iendp1
 #ifdef VISC_3DCOEF
 # ifdef UV_U3ADV_SPLIT
-                cff=0.125_r8*                                           &
-     &              (Vvis3d_r(i,j-1,k  )+Vvis3d_r(i,j,k  )+             &
-     &               Vvis3d_r(i,j-1,k+1)+Vvis3d_r(i,j,k+1))
+                  cff=0.125_r8*                                         &
+     &                (Vvis3d_r(i,j-1,k  )+Vvis3d_r(i,j,k  )+           &
+     &                 Vvis3d_r(i,j-1,k+1)+Vvis3d_r(i,j,k+1))
 # else
-                cff=0.125_r8*                                           &
-     &              (visc3d_r(i,j-1,k  )+visc3d_r(i,j,k  )+             &
-     &               visc3d_r(i,j-1,k+1)+visc3d_r(i,j,k+1))
+                  cff=0.125_r8*                                         &
+     &                (visc3d_r(i,j-1,k  )+visc3d_r(i,j,k  )+           &
+     &                 visc3d_r(i,j-1,k+1)+visc3d_r(i,j,k+1))
 # endif
-                fac1=cff*on_v(i,j)
-                fac2=cff*om_v(i,j)
+                  fac1=cff*on_v(i,j)
+                  fac2=cff*om_v(i,j)
 #else
-                cff=0.25_r8*(visc4_r(i,j-1)+visc4_r(i,j))
-                fac1=cff*on_v(i,j)
-                fac2=cff*om_v(i,j)
+                  cff=0.25_r8*(visc4_r(i,j-1)+visc4_r(i,j))
+                  fac1=cff*on_v(i,j)
+                  fac2=cff*om_v(i,j)
 #endif
-                cff=0.5_r8*(pn(i,j-1)+pn(i,j))
-                dnUdz=cff*0.25_r8*(dUdz(i  ,j  ,k2)+                    &
-     &                             dUdz(i+1,j  ,k2)+                    &
-     &                             dUdz(i  ,j-1,k2)+                    &
-     &                             dUdz(i+1,j-1,k2))
-                dnVdz=cff*dVdz(i,j,k2)
-                cff=0.5_r8*(pm(i,j-1)+pm(i,j))
-                dmUdz=cff*0.25_r8*(dUdz(i  ,j  ,k2)+                    &
-     &                             dUdz(i+1,j  ,k2)+                    &
-     &                             dUdz(i  ,j-1,k2)+                    &
-     &                             dUdz(i+1,j-1,k2))
-                dmVdz=cff*dVdz(i,j,k2)
+                  cff=pn_v(i,j)
+                  dnUdz=cff*0.25_r8*(dUdz(i  ,j  ,k2)+                  &
+     &                               dUdz(i+1,j  ,k2)+                  &
+     &                               dUdz(i  ,j-1,k2)+                  &
+     &                               dUdz(i+1,j-1,k2))
+                  dnVdz=cff*dVdz(i,j,k2)
+                  cff=pm_v(i,j)
+                  dmUdz=cff*0.25_r8*(dUdz(i  ,j  ,k2)+                  &
+     &                               dUdz(i+1,j  ,k2)+                  &
+     &                               dUdz(i  ,j-1,k2)+                  &
+     &                               dUdz(i+1,j-1,k2))
+                  dmVdz=cff*dVdz(i,j,k2)
 
-                cff1=MIN(dZdx_p(i  ,j,k1),0.0_r8)
-                cff2=MIN(dZdx_p(i+1,j,k2),0.0_r8)
-                cff3=MAX(dZdx_p(i  ,j,k2),0.0_r8)
-                cff4=MAX(dZdx_p(i+1,j,k1),0.0_r8)
-                VFsx(i,j,k2)=fac1*                                      &
-     &                       (cff1*(cff1*dnVdz-dnVdx(i  ,j,k1))+        &
-     &                        cff2*(cff2*dnVdz-dnVdx(i+1,j,k2))+        &
-     &                        cff3*(cff3*dnVdz-dnVdx(i  ,j,k2))+        &
-     &                        cff4*(cff4*dnVdz-dnVdx(i+1,j,k1)))
+                  cff1=MIN(dZdx_p(i  ,j,kw1),0.0_r8)
+                  cff2=MIN(dZdx_p(i+1,j,kw2),0.0_r8)
+                  cff3=MAX(dZdx_p(i  ,j,kw2),0.0_r8)
+                  cff4=MAX(dZdx_p(i+1,j,kw1),0.0_r8)
+                  VFsx(i,j,k2)=fac1*                                    &
+     &                         (cff1*(cff1*dnVdz-dnVdx(i  ,j,k1))+      &
+     &                          cff2*(cff2*dnVdz-dnVdx(i+1,j,k2))+      &
+     &                          cff3*(cff3*dnVdz-dnVdx(i  ,j,k2))+      &
+     &                          cff4*(cff4*dnVdz-dnVdx(i+1,j,k1)))
 
-                cff1=MIN(dZde_r(i,j-1,k1),0.0_r8)
-                cff2=MIN(dZde_r(i,j  ,k2),0.0_r8)
-                cff3=MAX(dZde_r(i,j-1,k2),0.0_r8)
-                cff4=MAX(dZde_r(i,j  ,k1),0.0_r8)
-                VFse(i,j,k2)=fac2*                                      &
-     &                       (cff1*(cff1*dmVdz-dmVde(i,j-1,k1))+        &
-     &                        cff2*(cff2*dmVdz-dmVde(i,j  ,k2))+        &
-     &                        cff3*(cff3*dmVdz-dmVde(i,j-1,k2))+        &
-     &                        cff4*(cff4*dmVdz-dmVde(i,j  ,k1)))
+                  cff1=MIN(dZde_r(i,j-1,kw1),0.0_r8)
+                  cff2=MIN(dZde_r(i,j  ,kw2),0.0_r8)
+                  cff3=MAX(dZde_r(i,j-1,kw2),0.0_r8)
+                  cff4=MAX(dZde_r(i,j  ,kw1),0.0_r8)
+                  VFse(i,j,k2)=fac2*                                    &
+     &                         (cff1*(cff1*dmVdz-dmVde(i,j-1,k1))+      &
+     &                          cff2*(cff2*dmVdz-dmVde(i,j  ,k2))+      &
+     &                          cff3*(cff3*dmVdz-dmVde(i,j-1,k2))+      &
+     &                          cff4*(cff4*dmVdz-dmVde(i,j  ,k1)))
 
-                cff1=MIN(dZde_r(i,j-1,k1),0.0_r8)
-                cff2=MIN(dZde_r(i,j  ,k2),0.0_r8)
-                cff3=MAX(dZde_r(i,j-1,k2),0.0_r8)
-                cff4=MAX(dZde_r(i,j  ,k1),0.0_r8)
-                cff5=MIN(dZdx_r(i,j-1,k1),0.0_r8)
-                cff6=MIN(dZdx_r(i,j  ,k2),0.0_r8)
-                cff7=MAX(dZdx_r(i,j-1,k2),0.0_r8)
-                cff8=MAX(dZdx_r(i,j  ,k1),0.0_r8)
-                VFsx(i,j,k2)=VFsx(i,j,k2)-                              &
-     &                       fac1*                                      &
-     &                       (cff1*(cff5*dnUdz-dnUdx(i,j-1,k1))+        &
-     &                        cff2*(cff6*dnUdz-dnUdx(i,j  ,k2))+        &
-     &                        cff3*(cff7*dnUdz-dnUdx(i,j-1,k2))+        &
-     &                        cff4*(cff8*dnUdz-dnUdx(i,j  ,k1)))
+                  cff1=MIN(dZde_r(i,j-1,kw1),0.0_r8)
+                  cff2=MIN(dZde_r(i,j  ,kw2),0.0_r8)
+                  cff3=MAX(dZde_r(i,j-1,kw2),0.0_r8)
+                  cff4=MAX(dZde_r(i,j  ,kw1),0.0_r8)
+                  cff5=MIN(dZdx_r(i,j-1,kw1),0.0_r8)
+                  cff6=MIN(dZdx_r(i,j  ,kw2),0.0_r8)
+                  cff7=MAX(dZdx_r(i,j-1,kw2),0.0_r8)
+                  cff8=MAX(dZdx_r(i,j  ,kw1),0.0_r8)
+                  VFsx(i,j,k2)=VFsx(i,j,k2)-                            &
+     &                         fac1*                                    &
+     &                         (cff1*(cff5*dnUdz-dnUdx(i,j-1,k1))+      &
+     &                          cff2*(cff6*dnUdz-dnUdx(i,j  ,k2))+      &
+     &                          cff3*(cff7*dnUdz-dnUdx(i,j-1,k2))+      &
+     &                          cff4*(cff8*dnUdz-dnUdx(i,j  ,k1)))
 
-                cff1=MIN(dZdx_p(i  ,j,k1),0.0_r8)
-                cff2=MIN(dZdx_p(i+1,j,k2),0.0_r8)
-                cff3=MAX(dZdx_p(i  ,j,k2),0.0_r8)
-                cff4=MAX(dZdx_p(i+1,j,k1),0.0_r8)
-                cff5=MIN(dZde_p(i  ,j,k1),0.0_r8)
-                cff6=MIN(dZde_p(i+1,j,k2),0.0_r8)
-                cff7=MAX(dZde_p(i  ,j,k2),0.0_r8)
-                cff8=MAX(dZde_p(i+1,j,k1),0.0_r8)
-                VFse(i,j,k2)=VFse(i,j,k2)+                              &
-     &                       fac2*                                      &
-     &                       (cff1*(cff5*dmUdz-dmUde(i  ,j,k1))+        &
-     &                        cff2*(cff6*dmUdz-dmUde(i+1,j,k2))+        &
-     &                        cff3*(cff7*dmUdz-dmUde(i  ,j,k2))+        &
-     &                        cff4*(cff8*dmUdz-dmUde(i+1,j,k1)))
+                  cff1=MIN(dZdx_p(i  ,j,kw1),0.0_r8)
+                  cff2=MIN(dZdx_p(i+1,j,kw2),0.0_r8)
+                  cff3=MAX(dZdx_p(i  ,j,kw2),0.0_r8)
+                  cff4=MAX(dZdx_p(i+1,j,kw1),0.0_r8)
+                  cff5=MIN(dZde_p(i  ,j,kw1),0.0_r8)
+                  cff6=MIN(dZde_p(i+1,j,kw2),0.0_r8)
+                  cff7=MAX(dZde_p(i  ,j,kw2),0.0_r8)
+                  cff8=MAX(dZde_p(i+1,j,kw1),0.0_r8)
+                  VFse(i,j,k2)=VFse(i,j,k2)+                            &
+     &                         fac2*                                    &
+     &                         (cff1*(cff5*dmUdz-dmUde(i  ,j,k1))+      &
+     &                          cff2*(cff6*dmUdz-dmUde(i+1,j,k2))+      &
+     &                          cff3*(cff7*dmUdz-dmUde(i  ,j,k2))+      &
+     &                          cff4*(cff8*dmUdz-dmUde(i+1,j,k1)))
+                END DO
               END DO
-            END DO
-          END IF
+            END IF
 !
 !  Compute first harmonic operator (m s^-3/2).
 !
-          DO j=Jstrm1,Jendp1
-            DO i=IstrUm1,Iendp1
-              cff=0.125_r8*(pm(i-1,j)+pm(i,j))*                         &
-     &                     (pn(i-1,j)+pn(i,j))
-              cff1=1.0_r8/(0.5_r8*(Hz(i-1,j,k)+Hz(i,j,k)))
-              LapU(i,j,k)=cff*((pn(i-1,j)+pn(i,j))*                     &
-                               (UFx(i,j)-UFx(i-1,j))+                   &
-     &                         (pm(i-1,j)+pm(i,j))*                     &
-     &                         (UFe(i,j+1)-UFe(i,j)))+                  &
-     &                    cff1*((UFsx(i,j,k2)+UFse(i,j,k2))-            &
-     &                          (UFsx(i,j,k1)+UFse(i,j,k1)))
+            DO j=Jstrm1,Jendp1
+              DO i=IstrUm1,Iendp1
+                cff=pm_u(i,j)*pn_u(i,j)
+                cff1=1.0_r8/(0.5_r8*(Hz(i-1,j,k)+Hz(i,j,k)))
+                LapU(i,j,kw1)=cff*(pn_u(i,j)*(UFx(i,j)-UFx(i-1,j))+     &
+     &                             pm_u(i,j)*(UFe(i,j+1)-UFe(i,j)))+    &
+     &                      cff1*((UFsx(i,j,k2)+UFse(i,j,k2))-          &
+     &                            (UFsx(i,j,k1)+UFse(i,j,k1)))
 #ifdef MASKING
-              LapU(i,j,k)=LapU(i,j,k)*umask(i,j)
+                LapU(i,j,kw1)=LapU(i,j,kw1)*umask(i,j)
 #endif
 #ifdef WET_DRY
-              LapU(i,j,k)=LapU(i,j,k)*umask_wet(i,j)
+                LapU(i,j,kw1)=LapU(i,j,kw1)*umask_wet(i,j)
 #endif
+              END DO
             END DO
-          END DO
 
-          DO j=JstrVm1,Jendp1
-            DO i=Istrm1,Iendp1
-              cff=0.125_r8*(pm(i,j)+pm(i,j-1))*                         &
-     &                     (pn(i,j)+pn(i,j-1))
-              cff1=1.0_r8/(0.5_r8*(Hz(i,j-1,k)+Hz(i,j,k)))
-              LapV(i,j,k)=cff*((pn(i,j-1)+pn(i,j))*                     &
-     &                         (VFx(i+1,j)-VFx(i,j))-                   &
-     &                         (pm(i,j-1)+pm(i,j))*                     &
-     &                         (VFe(i,j)-VFe(i,j-1)))+                  &
-     &                    cff1*((VFsx(i,j,k2)+VFse(i,j,k2))-            &
-     &                          (VFsx(i,j,k1)+VFse(i,j,k1)))
+            DO j=JstrVm1,Jendp1
+              DO i=Istrm1,Iendp1
+                cff=pm_v(i,j)*pn_v(i,j)
+                cff1=1.0_r8/(0.5_r8*(Hz(i,j-1,k)+Hz(i,j,k)))
+                LapV(i,j,kw1)=cff*(pn_v(i,j)*(VFx(i+1,j)-VFx(i,j))-     &
+     &                             pm_v(i,j)*(VFe(i,j)-VFe(i,j-1)))+    &
+     &                      cff1*((VFsx(i,j,k2)+VFse(i,j,k2))-          &
+     &                            (VFsx(i,j,k1)+VFse(i,j,k1)))
 #ifdef MASKING
-              LapV(i,j,k)=LapV(i,j,k)*vmask(i,j)
+                LapV(i,j,kw1)=LapV(i,j,kw1)*vmask(i,j)
 #endif
 #ifdef WET_DRY
-              LapV(i,j,k)=LapV(i,j,k)*vmask_wet(i,j)
+                LapV(i,j,kw1)=LapV(i,j,kw1)*vmask_wet(i,j)
 #endif
+              END DO
             END DO
-          END DO
-        END IF
-      END DO K_LOOP1
 !
 !  Apply boundary conditions (closed or gradient; except periodic)
-!  to the first harmonic operator.
+!  to the first harmonic operator at this level.
 !
-      IF (.not.(CompositeGrid(iwest,ng).or.EWperiodic(ng))) THEN
-        IF (DOMAIN(ng)%Western_Edge(tile)) THEN
-          IF (LBC(iwest,isUvel,ng)%closed) THEN
-            DO k=1,N(ng)
-              DO j=Jstrm1,Jendp1
-                LapU(IstrU-1,j,k)=0.0_r8
-              END DO
-            END DO
-          ELSE
-            DO k=1,N(ng)
-              DO j=Jstrm1,Jendp1
-                LapU(IstrU-1,j,k)=LapU(IstrU,j,k)
-              END DO
-            END DO
-          END IF
-          IF (LBC(iwest,isVvel,ng)%closed) THEN
-            DO k=1,N(ng)
-              DO j=JstrVm1,Jendp1
-                LapV(Istr-1,j,k)=gamma2(ng)*LapV(Istr,j,k)
-              END DO
-            END DO
-          ELSE
-            DO k=1,N(ng)
-              DO j=JstrVm1,Jendp1
-                LapV(Istr-1,j,k)=0.0_r8
-              END DO
-            END DO
-          END IF
-        END IF
-      END IF
+            IF (.not.(CompositeGrid(iwest,ng).or.EWperiodic(ng))) THEN
+              IF (DOMAIN(ng)%Western_Edge(tile)) THEN
+                IF (LBC(iwest,isUvel,ng)%closed) THEN
+                  DO j=Jstrm1,Jendp1
+                    LapU(IstrU-1,j,kw1)=0.0_r8
+                  END DO
+                ELSE
+                  DO j=Jstrm1,Jendp1
+                    LapU(IstrU-1,j,kw1)=LapU(IstrU,j,kw1)
+                  END DO
+                END IF
+                IF (LBC(iwest,isVvel,ng)%closed) THEN
+                  DO j=JstrVm1,Jendp1
+                    LapV(Istr-1,j,kw1)=gamma2(ng)*LapV(Istr,j,kw1)
+                  END DO
+                ELSE
+                  DO j=JstrVm1,Jendp1
+                    LapV(Istr-1,j,kw1)=0.0_r8
+                  END DO
+                END IF
+              END IF
+            END IF
 !
-      IF (.not.(CompositeGrid(ieast,ng).or.EWperiodic(ng))) THEN
-        IF (DOMAIN(ng)%Eastern_Edge(tile)) THEN
-          IF (LBC(ieast,isUvel,ng)%closed) THEN
-            DO k=1,N(ng)
-              DO j=Jstrm1,Jendp1
-                LapU(Iend+1,j,k)=0.0_r8
-              END DO
-            END DO
-          ELSE
-            DO k=1,N(ng)
-              DO j=Jstrm1,Jendp1
-                LapU(Iend+1,j,k)=LapU(Iend,j,k)
-              END DO
-            END DO
-          END IF
-          IF (LBC(ieast,isVvel,ng)%closed) THEN
-            DO k=1,N(ng)
-              DO j=JstrVm1,Jendp1
-                LapV(Iend+1,j,k)=gamma2(ng)*LapV(Iend,j,k)
-              END DO
-            END DO
-          ELSE
-            DO k=1,N(ng)
-              DO j=JstrVm1,Jendp1
-                LapV(Iend+1,j,k)=0.0_r8
-              END DO
-            END DO
-          END IF
-        END IF
-      END IF
+            IF (.not.(CompositeGrid(ieast,ng).or.EWperiodic(ng))) THEN
+              IF (DOMAIN(ng)%Eastern_Edge(tile)) THEN
+                IF (LBC(ieast,isUvel,ng)%closed) THEN
+                  DO j=Jstrm1,Jendp1
+                    LapU(Iend+1,j,kw1)=0.0_r8
+                  END DO
+                ELSE
+                  DO j=Jstrm1,Jendp1
+                    LapU(Iend+1,j,kw1)=LapU(Iend,j,kw1)
+                  END DO
+                END IF
+                IF (LBC(ieast,isVvel,ng)%closed) THEN
+                  DO j=JstrVm1,Jendp1
+                    LapV(Iend+1,j,kw1)=gamma2(ng)*LapV(Iend,j,kw1)
+                  END DO
+                ELSE
+                  DO j=JstrVm1,Jendp1
+                    LapV(Iend+1,j,kw1)=0.0_r8
+                  END DO
+                END IF
+              END IF
+            END IF
 !
-      IF (.not.(CompositeGrid(isouth,ng).or.NSperiodic(ng))) THEN
-        IF (DOMAIN(ng)%Southern_Edge(tile)) THEN
-          IF (LBC(isouth,isUvel,ng)%closed) THEN
-            DO k=1,N(ng)
-              DO i=IstrUm1,Iendp1
-                LapU(i,Jstr-1,k)=gamma2(ng)*LapU(i,Jstr,k)
-              END DO
-            END DO
-          ELSE
-            DO k=1,N(ng)
-              DO i=IstrUm1,Iendp1
-                LapU(i,Jstr-1,k)=0.0_r8
-              END DO
-            END DO
-          END IF
-          IF (LBC(isouth,isVvel,ng)%closed) THEN
-            DO k=1,N(ng)
-              DO i=Istrm1,Iendp1
-                LapV(i,JstrV-1,k)=0.0_r8
-              END DO
-            END DO
-          ELSE
-            DO k=1,N(ng)
-              DO i=Istrm1,Iendp1
-                LapV(i,JstrV-1,k)=LapV(i,JstrV,k)
-              END DO
-            END DO
-          END IF
-        END IF
-      END IF
+            IF (.not.(CompositeGrid(isouth,ng).or.NSperiodic(ng))) THEN
+              IF (DOMAIN(ng)%Southern_Edge(tile)) THEN
+                IF (LBC(isouth,isUvel,ng)%closed) THEN
+                  DO i=IstrUm1,Iendp1
+                    LapU(i,Jstr-1,kw1)=gamma2(ng)*LapU(i,Jstr,kw1)
+                  END DO
+                ELSE
+                  DO i=IstrUm1,Iendp1
+                    LapU(i,Jstr-1,kw1)=0.0_r8
+                  END DO
+                END IF
+                IF (LBC(isouth,isVvel,ng)%closed) THEN
+                  DO i=Istrm1,Iendp1
+                    LapV(i,JstrV-1,kw1)=0.0_r8
+                  END DO
+                ELSE
+                  DO i=Istrm1,Iendp1
+                    LapV(i,JstrV-1,kw1)=LapV(i,JstrV,kw1)
+                  END DO
+                END IF
+              END IF
+            END IF
 !
-      IF (.not.(CompositeGrid(inorth,ng).or.NSperiodic(ng))) THEN
-        IF (DOMAIN(ng)%Northern_Edge(tile)) THEN
-          IF (LBC(inorth,isUvel,ng)%closed) THEN
-            DO k=1,N(ng)
-              DO i=IstrUm1,Iendp1
-                LapU(i,Jend+1,k)=gamma2(ng)*LapU(i,Jend,k)
-              END DO
-            END DO
-          ELSE
-            DO k=1,N(ng)
-              DO i=IstrUm1,Iendp1
-                LapU(i,Jend+1,k)=0.0_r8
-              END DO
-            END DO
-          END IF
-          IF (LBC(inorth,isVvel,ng)%closed) THEN
-            DO k=1,N(ng)
-              DO i=Istrm1,Iendp1
-                LapV(i,Jend+1,k)=0.0_r8
-              END DO
-            END DO
-          ELSE
-            DO k=1,N(ng)
-              DO i=Istrm1,Iendp1
-                LapV(i,Jend+1,k)=LapV(i,Jend,k)
-              END DO
-            END DO
-          END IF
-        END IF
-      END IF
+            IF (.not.(CompositeGrid(inorth,ng).or.NSperiodic(ng))) THEN
+              IF (DOMAIN(ng)%Northern_Edge(tile)) THEN
+                IF (LBC(inorth,isUvel,ng)%closed) THEN
+                  DO i=IstrUm1,Iendp1
+                    LapU(i,Jend+1,kw1)=gamma2(ng)*LapU(i,Jend,kw1)
+                  END DO
+                ELSE
+                  DO i=IstrUm1,Iendp1
+                    LapU(i,Jend+1,kw1)=0.0_r8
+                  END DO
+                END IF
+                IF (LBC(inorth,isVvel,ng)%closed) THEN
+                  DO i=Istrm1,Iendp1
+                    LapV(i,Jend+1,kw1)=0.0_r8
+                  END DO
+                ELSE
+                  DO i=Istrm1,Iendp1
+                    LapV(i,Jend+1,kw1)=LapV(i,Jend,kw1)
+                  END DO
+                END IF
+              END IF
+            END IF
 !
-      IF (.not.(CompositeGrid(isouth,ng).or.NSperiodic(ng).or.          &
-     &          CompositeGrid(iwest ,ng).or.EWperiodic(ng))) THEN
-        IF (DOMAIN(ng)%SouthWest_Corner(tile)) THEN
-          DO k=1,N(ng)
-            LapU(Istr  ,Jstr-1,k)=0.5_r8*(LapU(Istr+1,Jstr-1,k)+        &
-     &                                    LapU(Istr  ,Jstr  ,k))
-            LapV(Istr-1,Jstr  ,k)=0.5_r8*(LapV(Istr-1,Jstr+1,k)+        &
-     &                                    LapV(Istr  ,Jstr  ,k))
-          END DO
-        END IF
-      END IF
+            IF (.not.(CompositeGrid(isouth,ng).or.NSperiodic(ng).or.    &
+     &                CompositeGrid(iwest ,ng).or.EWperiodic(ng))) THEN
+              IF (DOMAIN(ng)%SouthWest_Corner(tile)) THEN
+                LapU(Istr  ,Jstr-1,kw1)=0.5_r8*                         &
+     &                                  (LapU(Istr+1,Jstr-1,kw1)+       &
+     &                                   LapU(Istr  ,Jstr  ,kw1))
+                LapV(Istr-1,Jstr  ,kw1)=0.5_r8*                         &
+     &                                  (LapV(Istr-1,Jstr+1,kw1)+       &
+     &                                   LapV(Istr  ,Jstr  ,kw1))
+              END IF
+            END IF
 
-      IF (.not.(CompositeGrid(isouth,ng).or.NSperiodic(ng).or.          &
-     &          CompositeGrid(ieast ,ng).or.EWperiodic(ng))) THEN
-        IF (DOMAIN(ng)%SouthEast_Corner(tile)) THEN
-          DO k=1,N(ng)
-            LapU(Iend+1,Jstr-1,k)=0.5_r8*(LapU(Iend  ,Jstr-1,k)+        &
-     &                                    LapU(Iend+1,Jstr  ,k))
-            LapV(Iend+1,Jstr  ,k)=0.5_r8*(LapV(Iend  ,Jstr  ,k)+        &
-     &                                    LapV(Iend+1,Jstr+1,k))
-          END DO
-        END IF
-      END IF
+            IF (.not.(CompositeGrid(isouth,ng).or.NSperiodic(ng).or.    &
+     &                CompositeGrid(ieast ,ng).or.EWperiodic(ng))) THEN
+              IF (DOMAIN(ng)%SouthEast_Corner(tile)) THEN
+                LapU(Iend+1,Jstr-1,kw1)=0.5_r8*                         &
+     &                                  (LapU(Iend  ,Jstr-1,kw1)+       &
+     &                                   LapU(Iend+1,Jstr  ,kw1))
+                LapV(Iend+1,Jstr  ,kw1)=0.5_r8*                         &
+     &                                  (LapV(Iend  ,Jstr  ,kw1)+       &
+     &                                   LapV(Iend+1,Jstr+1,kw1))
+              END IF
+            END IF
 
-      IF (.not.(CompositeGrid(inorth,ng).or.NSperiodic(ng).or.          &
-     &          CompositeGrid(iwest ,ng).or.EWperiodic(ng))) THEN
-        IF (DOMAIN(ng)%NorthWest_Corner(tile)) THEN
-          DO k=1,N(ng)
-            LapU(Istr  ,Jend+1,k)=0.5_r8*(LapU(Istr+1,Jend+1,k)+        &
-     &                                    LapU(Istr  ,Jend  ,k))
-            LapV(Istr-1,Jend+1,k)=0.5_r8*(LapV(Istr  ,Jend+1,k)+        &
-     &                                    LapV(Istr-1,Jend  ,k))
-          END DO
-        END IF
-      END IF
+            IF (.not.(CompositeGrid(inorth,ng).or.NSperiodic(ng).or.    &
+     &                CompositeGrid(iwest ,ng).or.EWperiodic(ng))) THEN
+              IF (DOMAIN(ng)%NorthWest_Corner(tile)) THEN
+                LapU(Istr  ,Jend+1,kw1)=0.5_r8*                         &
+     &                                  (LapU(Istr+1,Jend+1,kw1)+       &
+     &                                   LapU(Istr  ,Jend  ,kw1))
+                LapV(Istr-1,Jend+1,kw1)=0.5_r8*                         &
+     &                                  (LapV(Istr  ,Jend+1,kw1)+       &
+     &                                   LapV(Istr-1,Jend  ,kw1))
+              END IF
+            END IF
 
-      IF (.not.(CompositeGrid(inorth,ng).or.NSperiodic(ng).or.          &
-     &          CompositeGrid(ieast ,ng).or.EWperiodic(ng))) THEN
-        IF (DOMAIN(ng)%NorthEast_Corner(tile)) THEN
-          DO k=1,N(ng)
-            LapU(Iend+1,Jend+1,k)=0.5_r8*(LapU(Iend  ,Jend+1,k)+        &
-     &                                    LapU(Iend+1,Jend  ,k))
-            LapV(Iend+1,Jend+1,k)=0.5_r8*(LapV(Iend  ,Jend+1,k)+        &
-     &                                    LapV(Iend+1,Jend  ,k))
-          END DO
+            IF (.not.(CompositeGrid(inorth,ng).or.NSperiodic(ng).or.    &
+     &                CompositeGrid(ieast ,ng).or.EWperiodic(ng))) THEN
+              IF (DOMAIN(ng)%NorthEast_Corner(tile)) THEN
+                LapU(Iend+1,Jend+1,kw1)=0.5_r8*                         &
+     &                                  (LapU(Iend  ,Jend+1,kw1)+       &
+     &                                   LapU(Iend+1,Jend  ,kw1))
+                LapV(Iend+1,Jend+1,kw1)=0.5_r8*                         &
+     &                                  (LapV(Iend  ,Jend+1,kw1)+       &
+     &                                   LapV(Iend+1,Jend  ,kw1))
+              END IF
+            END IF
+          END IF
         END IF
-      END IF
 !
 !  Compute horizontal and vertical gradients associated with the
-!  second rotated harmonic operator.
-!
-      k2=1
-      K_LOOP2 : DO k=0,N(ng)
-        k1=k2
-        k2=3-k1
-        IF (k.lt.N(ng)) THEN
-!
-!  Compute slopes (nondimensional) at RHO- and PSI-points.
+!  second rotated harmonic operator at level "k".  The slopes and the
+!  first harmonic operator at levels "k" and "k+1" are available from
+!  the sliding window.
 !
-          DO j=Jstr-1,Jend+1
-            DO i=IstrU-1,Iend+1
-              cff=0.5_r8*(pm(i-1,j)+pm(i,j))
-#ifdef MASKING
-              cff=cff*umask(i,j)
-#endif
-#ifdef WET_DRY
-              cff=cff*umask_wet(i,j)
-#endif
-              UFx(i,j)=cff*(z_r(i  ,j,k+1)-                             &
-     &                      z_r(i-1,j,k+1))
-            END DO
-          END DO
-          DO j=JstrV-1,Jend+1
-            DO i=Istr-1,Iend+1
-              cff=0.5_r8*(pn(i,j-1)+pn(i,j))
-#ifdef MASKING
-              cff=cff*vmask(i,j)
-#endif
-#ifdef WET_DRY
-              cff=cff*vmask_wet(i,j)
-#endif
-              VFe(i,j)=cff*(z_r(i,j  ,k+1)-                             &
-     &                      z_r(i,j-1,k+1))
-            END DO
-          END DO
-!
-          DO j=Jstr,Jend+1
-            DO i=Istr,Iend+1
-              dZdx_p(i,j,k2)=0.5_r8*(UFx(i,j-1)+                        &
-     &                               UFx(i,j  ))
-              dZde_p(i,j,k2)=0.5_r8*(VFe(i-1,j)+                        &
-     &                               VFe(i  ,j))
-            END DO
-          END DO
-          DO j=JstrV-1,Jend
-            DO i=IstrU-1,Iend
-              dZdx_r(i,j,k2)=0.5_r8*(UFx(i  ,j)+                        &
-     &                               UFx(i+1,j))
-              dZde_r(i,j,k2)=0.5_r8*(VFe(i,j  )+                        &
-     &                               VFe(i,j+1))
-            END DO
-          END DO
+        k=kk-1
+        IF (k.ge.0) THEN
+          k3=k4
+          k4=7-k3
+          kw1=MOD(k,3)+1
+          kw2=MOD(k+1,3)+1
+          IF (k.lt.N(ng)) THEN
 !
 !  Compute momentum horizontal (m^-1 s^-3/2) and vertical (s^-3/2)
 !  gradients.
 !
-          DO j=JstrV-1,Jend
-            DO i=IstrU-1,Iend
-              cff=0.5_r8*pm(i,j)
+            DO j=JstrV-1,Jend
+              DO i=IstrU-1,Iend
+                cff=0.5_r8*pm(i,j)
 #ifdef MASKING
-              cff=cff*rmask(i,j)
+                cff=cff*rmask(i,j)
 #endif
 #ifdef WET_DRY
-              cff=cff*rmask_wet(i,j)
+                cff=cff*rmask_wet(i,j)
 #endif
-              dnUdx(i,j,k2)=cff*((pn(i  ,j)+pn(i+1,j))*                 &
-     &                           LapU(i+1,j,k+1)-                       &
-     &                           (pn(i-1,j)+pn(i  ,j))*                 &
-     &                           LapU(i  ,j,k+1))
+                dnUdx(i,j,k4)=cff*((pn(i  ,j)+pn(i+1,j))*               &
+     &                             LapU(i+1,j,kw2)-                     &
+     &                             (pn(i-1,j)+pn(i  ,j))*               &
+     &                             LapU(i  ,j,kw2))
+              END DO
             END DO
-          END DO
 
-          DO j=Jstr,Jend+1
-            DO i=Istr,Iend+1
-              cff=0.125_r8*(pn(i-1,j  )+pn(i,j  )+                      &
-     &                      pn(i-1,j-1)+pn(i,j-1))
+            DO j=Jstr,Jend+1
+              DO i=Istr,Iend+1
+                cff=0.125_r8*(pn(i-1,j  )+pn(i,j  )+                    &
+     &                        pn(i-1,j-1)+pn(i,j-1))
 #ifdef MASKING
-              cff=cff*pmask(i,j)
+                cff=cff*pmask(i,j)
 #endif
 #ifdef WET_DRY
-              cff=cff*pmask_wet(i,j)
+                cff=cff*pmask_wet(i,j)
 #endif
-              dmUde(i,j,k2)=cff*((pm(i-1,j  )+pm(i,j  ))*               &
-     &                           LapU(i,j  ,k+1)-                       &
-     &                           (pm(i-1,j-1)+pm(i,j-1))*               &
-     &                           LapU(i,j-1,k+1))
+                dmUde(i,j,k4)=cff*((pm(i-1,j  )+pm(i,j  ))*             &
+     &                             LapU(i,j  ,kw2)-                     &
+     &                             (pm(i-1,j-1)+pm(i,j-1))*             &
+     &                             LapU(i,j-1,kw2))
+              END DO
             END DO
-          END DO
 
-          DO j=Jstr,Jend+1
-            DO i=Istr,Iend+1
-              cff=0.125_r8*(pm(i-1,j  )+pm(i,j  )+                      &
-     &                      pm(i-1,j-1)+pm(i,j-1))
+            DO j=Jstr,Jend+1
+              DO i=Istr,Iend+1
+                cff=0.125_r8*(pm(i-1,j  )+pm(i,j  )+                    &
+     &                        pm(i-1,j-1)+pm(i,j-1))
 #ifdef MASKING
-              cff=cff*pmask(i,j)
+                cff=cff*pmask(i,j)
 #endif
 #ifdef WET_DRY
-              cff=cff*pmask_wet(i,j)
+                cff=cff*pmask_wet(i,j)
 #endif
-              dnVdx(i,j,k2)=cff*((pn(i  ,j-1)+pn(i  ,j))*               &
-     &                           LapV(i  ,j,k+1)-                       &
-     &                           (pn(i-1,j-1)+pn(i-1,j))*               &
-     &                           LapV(i-1,j,k+1))
+                dnVdx(i,j,k4)=cff*((pn(i  ,j-1)+pn(i  ,j))*             &
+     &                             LapV(i  ,j,kw2)-                     &
+     &                             (pn(i-1,j-1)+pn(i-1,j))*             &
+     &                             LapV(i-1,j,kw2))
+              END DO
             END DO
-          END DO
 
-          DO j=JstrV-1,Jend
-            DO i=IstrU-1,Iend
-              cff=0.5_r8*pn(i,j)
+            DO j=JstrV-1,Jend
+              DO i=IstrU-1,Iend
+                cff=0.5_r8*pn(i,j)
 #ifdef MASKING
-              cff=cff*rmask(i,j)
+                cff=cff*rmask(i,j)
 #endif
 #ifdef WET_DRY
-              cff=cff*rmask_wet(i,j)
+                cff=cff*rmask_wet(i,j)
 #endif
-              dmVde(i,j,k2)=cff*((pm(i,j  )+pm(i,j+1))*                 &
-     &                           LapV(i,j+1,k+1)-                       &
-     &                           (pm(i,j-1)+pm(i,j  ))*                 &
-     &                           LapV(i,j  ,k+1))
+                dmVde(i,j,k4)=cff*((pm(i,j  )+pm(i,j+1))*               &
+     &                             LapV(i,j+1,kw2)-                     &
+     &                             (pm(i,j-1)+pm(i,j  ))*               &
+     &                             LapV(i,j  ,kw2))
+              END DO
             END DO
-          END DO
-        END IF
+          END IF
 
-        IF ((k.eq.0).or.(k.eq.N(ng))) THEN
-          DO j=Jstr-1,Jend+1
-            DO i=IstrU-1,Iend+1
-              dUdz(i,j,k2)=0.0_r8
+          IF ((k.eq.0).or.(k.eq.N(ng))) THEN
+            DO j=Jstr-1,Jend+1
+              DO i=IstrU-1,Iend+1
+                dUdz(i,j,k4)=0.0_r8
+              END DO
             END DO
-          END DO
-          DO j=JstrV-1,Jend+1
-            DO i=Istr-1,Iend+1
-              dVdz(i,j,k2)=0.0_r8
+            DO j=JstrV-1,Jend+1
+              DO i=Istr-1,Iend+1
+                dVdz(i,j,k4)=0.0_r8
+              END DO
             END DO
-          END DO
 
-          DO j=Jstr,Jend
-            DO i=IstrU,Iend
-              UFsx(i,j,k2)=0.0_r8
-              UFse(i,j,k2)=0.0_r8
+            DO j=Jstr,Jend
+              DO i=IstrU,Iend
+                UFsx(i,j,k4)=0.0_r8
+                UFse(i,j,k4)=0.0_r8
+              END DO
             END DO
-          END DO
-          DO j=JstrV,Jend
-            DO i=Istr,Iend
-              VFsx(i,j,k2)=0.0_r8
-              VFse(i,j,k2)=0.0_r8
+            DO j=JstrV,Jend
+              DO i=Istr,Iend
+                VFsx(i,j,k4)=0.0_r8
+                VFse(i,j,k4)=0.0_r8
+              END DO
             END DO
-          END DO
-        ELSE
-          DO j=Jstr-1,Jend+1
-            DO i=IstrU-1,Iend+1
-              cff=1.0_r8/(0.5_r8*(z_r(i-1,j,k+1)-                       &
-     &                            z_r(i-1,j,k  )+                       &
-     &                            z_r(i  ,j,k+1)-                       &
-     &                            z_r(i  ,j,k  )))
-              dUdz(i,j,k2)=cff*(LapU(i,j,k+1)-                          &
-     &                          LapU(i,j,k  ))
+          ELSE
+            DO j=Jstr-1,Jend+1
+              DO i=IstrU-1,Iend+1
+                cff=1.0_r8/(0.5_r8*(z_r(i-1,j,k+1)-                     &
+     &                              z_r(i-1,j,k  )+                     &
+     &                              z_r(i  ,j,k+1)-                     &
+     &                              z_r(i  ,j,k  )))
+                dUdz(i,j,k4)=cff*(LapU(i,j,kw2)-                        &
+     &                            LapU(i,j,kw1))
+              END DO
             END DO
-          END DO
-          DO j=JstrV-1,Jend+1
-            DO i=Istr-1,Iend+1
-              cff=1.0_r8/(0.5_r8*(z_r(i,j-1,k+1)-                       &
-     &                            z_r(i,j-1,k  )+                       &
-     &                            z_r(i,j  ,k+1)-                       &
-     &                            z_r(i,j  ,k  )))
-              dVdz(i,j,k2)=cff*(LapV(i,j,k+1)-                          &
-     &                          LapV(i,j,k  ))
+            DO j=JstrV-1,Jend+1
+              DO i=Istr-1,Iend+1
+                cff=1.0_r8/(0.5_r8*(z_r(i,j-1,k+1)-                     &
+     &                              z_r(i,j-1,k  )+                     &
+     &                              z_r(i,j  ,k+1)-                     &
+     &                              z_r(i,j  ,k  )))
+                dVdz(i,j,k4)=cff*(LapV(i,j,kw2)-                        &
+     &                            LapV(i,j,kw1))
+              END DO
             END DO
-          END DO
-        END IF
+          END IF
 !
 !  Compute components of the rotated viscous flux (m5/s2) along
 !  geopotential surfaces in the XI- and ETA-directions.
 !
-        IF (k.gt.0) THEN
-          DO j=JstrV-1,Jend
-            DO i=IstrU-1,Iend
-              cff1=MIN(dZdx_r(i,j,k1),0.0_r8)
-              cff2=MAX(dZdx_r(i,j,k1),0.0_r8)
-              cff3=MIN(dZde_r(i,j,k1),0.0_r8)
-              cff4=MAX(dZde_r(i,j,k1),0.0_r8)
-              cff=Hz(i,j,k)*                                            &
-     &            (on_r(i,j)*(dnUdx(i,j,k1)-                            &
-     &                        0.5_r8*pn(i,j)*                           &
-     &                        (cff1*(dUdz(i  ,j,k1)+                    &
-     &                               dUdz(i+1,j,k2))+                   &
-     &                         cff2*(dUdz(i  ,j,k2)+                    &
-     &                               dUdz(i+1,j,k1))))-                 &
-     &             om_r(i,j)*(dmVde(i,j,k1)-                            &
-     &                        0.5_r8*pm(i,j)*                           &
-     &                        (cff3*(dVdz(i,j  ,k1)+                    &
-     &                               dVdz(i,j+1,k2))+                   &
-     &                         cff4*(dVdz(i,j  ,k2)+                    &
-     &                               dVdz(i,j+1,k1)))))
+          IF (k.gt.0) THEN
+            DO j=JstrV-1,Jend
+              DO i=IstrU-1,Iend
+                cff1=MIN(dZdx_r(i,j,kw1),0.0_r8)
+                cff2=MAX(dZdx_r(i,j,kw1),0.0_r8)
+                cff3=MIN(dZde_r(i,j,kw1),0.0_r8)
+                cff4=MAX(dZde_r(i,j,kw1),0.0_r8)
+                cff=Hz(i,j,k)*                                          &
+     &              (on_r(i,j)*(dnUdx(i,j,k3)-                          &
+     &                          0.5_r8*pn(i,j)*                         &
+     &                          (cff1*(dUdz(i  ,j,k3)+                  &
+     &                                 dUdz(i+1,j,k4))+                 &
+     &                           cff2*(dUdz(i  ,j,k4)+                  &
+     &                                 dUdz(i+1,j,k3))))-               &
+     &               om_r(i,j)*(dmVde(i,j,k3)-                          &
+     &                          0.5_r8*pm(i,j)*                         &
+     &                          (cff3*(dVdz(i,j  ,k3)+                  &
+     &                                 dVdz(i,j+1,k4))+                 &
+     &                           cff4*(dVdz(i,j  ,k4)+                  &
+     &                                 dVdz(i,j+1,k3)))))
 #ifdef MASKING
-              cff=cff*rmask(i,j)
+                cff=cff*rmask(i,j)
 #endif
 #ifdef WET_DRY
-              cff=cff*rmask_wet(i,j)
+                cff=cff*rmask_wet(i,j)
 #endif
 #ifdef VISC_3DCOEF
 # ifdef UV_U3ADV_SPLIT
-              UFx(i,j)=on_r(i,j)*on_r(i,j)*Uvis3d_r(i,j,k)*cff
-              VFe(i,j)=om_r(i,j)*om_r(i,j)*Vvis3d_r(i,j,k)*cff
+                UFx(i,j)=on_r(i,j)*on_r(i,j)*Uvis3d_r(i,j,k)*cff
+                VFe(i,j)=om_r(i,j)*om_r(i,j)*Vvis3d_r(i,j,k)*cff
 # else
-              UFx(i,j)=on_r(i,j)*on_r(i,j)*visc3d_r(i,j,k)*cff
-              VFe(i,j)=om_r(i,j)*om_r(i,j)*visc3d_r(i,j,k)*cff
+                UFx(i,j)=on_r(i,j)*on_r(i,j)*visc3d_r(i,j,k)*cff
+                VFe(i,j)=om_r(i,j)*om_r(i,j)*visc3d_r(i,j,k)*cff
 # endif
 #else
-              UFx(i,j)=on_r(i,j)*on_r(i,j)*visc4_r(i,j)*cff
-              VFe(i,j)=om_r(i,j)*om_r(i,j)*visc4_r(i,j)*cff
+                UFx(i,j)=on_r(i,j)*on_r(i,j)*visc4_r(i,j)*cff
+                VFe(i,j)=om_r(i,j)*om_r(i,j)*visc4_r(i,j)*cff
 #endif
+              END DO
             END DO
-          END DO
 
-          DO j=Jstr,Jend+1
-            DO i=Istr,Iend+1
-              pm_p=0.25_r8*(pm(i-1,j-1)+pm(i-1,j)+                      &
-     &                      pm(i  ,j-1)+pm(i  ,j))
-              pn_p=0.25_r8*(pn(i-1,j-1)+pn(i-1,j)+                      &
-     &                      pn(i  ,j-1)+pn(i  ,j))
-              cff1=MIN(dZdx_p(i,j,k1),0.0_r8)
-              cff2=MAX(dZdx_p(i,j,k1),0.0_r8)
-              cff3=MIN(dZde_p(i,j,k1),0.0_r8)
-              cff4=MAX(dZde_p(i,j,k1),0.0_r8)
-              cff=0.25_r8*                                              &
-     &            (Hz(i-1,j  ,k)+Hz(i,j  ,k)+                           &
-     &             Hz(i-1,j-1,k)+Hz(i,j-1,k))*                          &
-     &             (on_p(i,j)*(dnVdx(i,j,k1)-                           &
-     &                         0.5_r8*pn_p*                             &
-     &                         (cff1*(dVdz(i-1,j,k1)+                   &
-     &                                dVdz(i  ,j,k2))+                  &
-     &                          cff2*(dVdz(i-1,j,k2)+                   &
-     &                                dVdz(i  ,j,k1))))+                &
-     &              om_p(i,j)*(dmUde(i,j,k1)-                           &
-     &                         0.5_r8*pm_p*                             &
-     &                         (cff3*(dUdz(i,j-1,k1)+                   &
-     &                                dUdz(i,j  ,k2))+                  &
-     &                          cff4*(dUdz(i,j-1,k2)+                   &
-     &                                dUdz(i,j  ,k1)))))
+            DO j=Jstr,Jend+1
+              DO i=Istr,Iend+1
+                pm_p=0.25_r8*(pm(i-1,j-1)+pm(i-1,j)+                    &
+     &                        pm(i  ,j-1)+pm(i  ,j))
+                pn_p=0.25_r8*(pn(i-1,j-1)+pn(i-1,j)+                    &
+     &                        pn(i  ,j-1)+pn(i  ,j))
+                cff1=MIN(dZdx_p(i,j,kw1),0.0_r8)
+                cff2=MAX(dZdx_p(i,j,kw1),0.0_r8)
+                cff3=MIN(dZde_p(i,j,kw1),0.0_r8)
+                cff4=MAX(dZde_p(i,j,kw1),0.0_r8)
+                cff=0.25_r8*                                            &
+     &              (Hz(i-1,j  ,k)+Hz(i,j  ,k)+                         &
+     &               Hz(i-1,j-1,k)+Hz(i,j-1,k))*                        &
+     &               (on_p(i,j)*(dnVdx(i,j,k3)-                         &
+     &                           0.5_r8*pn_p*                           &
+     &                           (cff1*(dVdz(i-1,j,k3)+                 &
+     &                                  dVdz(i  ,j,k4))+                &
+     &                            cff2*(dVdz(i-1,j,k4)+                 &
+     &                                  dVdz(i  ,j,k3))))+              &
+     &                om_p(i,j)*(dmUde(i,j,k3)-                         &
+     &                           0.5_r8*pm_p*                           &
+     &                           (cff3*(dUdz(i,j-1,k3)+                 &
+     &                                  dUdz(i,j  ,k4))+                &
+     &                            cff4*(dUdz(i,j-1,k4)+                 &
+     &                                  dUdz(i,j  ,k3)))))
 #ifdef MASKING
-              cff=cff*pmask(i,j)
+                cff=cff*pmask(i,j)
 #endif
 #ifdef WET_DRY
-              cff=cff*pmask_wet(i,j)
+                cff=cff*pmask_wet(i,j)
 #endif
 #ifdef VISC_3DCOEF
 # ifdef UV_U3ADV_SPLIT
-              Uvis_p=0.25_r8*                                           &
-     &               (Uvis3d_r(i-1,j-1,k)+Uvis3d_r(i-1,j,k)+            &
-     &                Uvis3d_r(i  ,j-1,k)+Uvis3d_r(i  ,j,k))
-              Vvis_p=0.25_r8*                                           &
-     &               (Vvis3d_r(i-1,j-1,k)+Vvis3d_r(i-1,j,k)+            &
-     &                Vvis3d_r(i  ,j-1,k)+Vvis3d_r(i  ,j,k))
-              UFe(i,j)=om_p(i,j)*om_p(i,j)*Uvis_p*cff
-              VFx(i,j)=on_p(i,j)*on_p(i,j)*Vvis_p*cff
+                Uvis_p=0.25_r8*                                         &
+     &                 (Uvis3d_r(i-1,j-1,k)+Uvis3d_r(i-1,j,k)+          &
+     &                  Uvis3d_r(i  ,j-1,k)+Uvis3d_r(i  ,j,k))
+                Vvis_p=0.25_r8*                                         &
+     &                 (Vvis3d_r(i-1,j-1,k)+Vvis3d_r(i-1,j,k)+          &
+     &                  Vvis3d_r(i  ,j-1,k)+Vvis3d_r(i  ,j,k))
+                UFe(i,j)=om_p(i,j)*om_p(i,j)*Uvis_p*cff
+                VFx(i,j)=on_p(i,j)*on_p(i,j)*Vvis_p*cff
 # else
-              visc_p=0.25_r8*                                           &
-     &               (visc3d_r(i-1,j-1,k)+visc3d_r(i-1,j,k)+            &
-     &                visc3d_r(i  ,j-1,k)+visc3d_r(i  ,j,k))
-              UFe(i,j)=om_p(i,j)*om_p(i,j)*visc_p*cff
-              VFx(i,j)=on_p(i,j)*on_p(i,j)*visc_p*cff
+                visc_p=0.25_r8*                                         &
+     &                 (visc3d_r(i-1,j-1,k)+visc3d_r(i-1,j,k)+          &
+     &                  visc3d_r(i  ,j-1,k)+visc3d_r(i  ,j,k))
+                UFe(i,j)=om_p(i,j)*om_p(i,j)*visc_p*cff
+                VFx(i,j)=on_p(i,j)*on_p(i,j)*visc_p*cff
 # endif
 #else
-              UFe(i,j)=om_p(i,j)*om_p(i,j)*visc4_p(i,j)*cff
-              VFx(i,j)=on_p(i,j)*on_p(i,j)*visc4_p(i,j)*cff
+                UFe(i,j)=om_p(i,j)*om_p(i,j)*visc4_p(i,j)*cff
+                VFx(i,j)=on_p(i,j)*on_p(i,j)*visc4_p(i,j)*cff
 #endif
+              END DO
             END DO
-          END DO
 !
 !  Compute vertical flux (m2/s2) due to sloping terrain-following
 !  surfaces.
 !
-          IF (k.lt.N(ng)) THEN
-            DO j=Jstr,Jend
-              DO i=IstrU,Iend
+            IF (k.lt.N(ng)) THEN
+              DO j=Jstr,Jend
+                DO i=IstrU,Iend
 #ifdef VISC_3DCOEF
 # ifdef UV_U3ADV_SPLIT
-                cff=0.125_r8*                                           &
-     &              (Uvis3d_r(i-1,j,k  )+Uvis3d_r(i,j,k  )+             &
-     &               Uvis3d_r(i-1,j,k+1)+Uvis3d_r(i,j,k+1))
+                  cff=0.125_r8*                                         &
+     &                (Uvis3d_r(i-1,j,k  )+Uvis3d_r(i,j,k  )+           &
+     &                 Uvis3d_r(i-1,j,k+1)+Uvis3d_r(i,j,k+1))
 # else
-                cff=0.125_r8*                                           &
-     &              (visc3d_r(i-1,j,k  )+visc3d_r(i,j,k  )+             &
-     &               visc3d_r(i-1,j,k+1)+visc3d_r(i,j,k+1))
+                  cff=0.125_r8*                                         &
+     &                (visc3d_r(i-1,j,k  )+visc3d_r(i,j,k  )+           &
+     &                 visc3d_r(i-1,j,k+1)+visc3d_r(i,j,k+1))
 # endif
-                fac1=cff*on_u(i,j)
-                fac2=cff*om_u(i,j)
+                  fac1=cff*on_u(i,j)
+                  fac2=cff*om_u(i,j)
 #else
-                cff=0.25_r8*(visc4_r(i-1,j)+visc4_r(i,j))
-                fac1=cff*on_u(i,j)
-                fac2=cff*om_u(i,j)
+                  cff=0.25_r8*(visc4_r(i-1,j)+visc4_r(i,j))
+                  fac1=cff*on_u(i,j)
+                  fac2=cff*om_u(i,j)
 #endif
-                cff=0.5_r8*(pn(i-1,j)+pn(i,j))
-                dnUdz=cff*dUdz(i,j,k2)
-                dnVdz=cff*0.25_r8*(dVdz(i-1,j+1,k2)+                    &
-     &                             dVdz(i  ,j+1,k2)+                    &
-     &                             dVdz(i-1,j  ,k2)+                    &
-     &                             dVdz(i  ,j  ,k2))
-                cff=0.5_r8*(pm(i-1,j)+pm(i,j))
-                dmUdz=cff*dUdz(i,j,k2)
-                dmVdz=cff*0.25_r8*(dVdz(i-1,j+1,k2)+                    &
-     &                             dVdz(i  ,j+1,k2)+                    &
-     &                             dVdz(i-1,j  ,k2)+                    &
-     &                             dVdz(i  ,j  ,k2))
+                  cff=pn_u(i,j)
+                  dnUdz=cff*dUdz(i,j,k4)
+                  dnVdz=cff*0.25_r8*(dVdz(i-1,j+1,k4)+                  &
+     &                               dVdz(i  ,j+1,k4)+                  &
+     &                               dVdz(i-1,j  ,k4)+                  &
+     &                               dVdz(i  ,j  ,k4))
+                  cff=pm_u(i,j)
+                  dmUdz=cff*dUdz(i,j,k4)
+                  dmVdz=cff*0.25_r8*(dVdz(i-1,j+1,k4)+                  &
+     &                               dVdz(i  ,j+1,k4)+                  &
+     &                               dVdz(i-1,j  ,k4)+                  &
+     &                               dVdz(i  ,j  ,k4))
 
-                cff1=MIN(dZdx_r(i-1,j,k1),0.0_r8)
-                cff2=MIN(dZdx_r(i  ,j,k2),0.0_r8)
-                cff3=MAX(dZdx_r(i-1,j,k2),0.0_r8)
-                cff4=MAX(dZdx_r(i  ,j,k1),0.0_r8)
-                UFsx(i,j,k2)=fac1*                                      &
-     &                       (cff1*(cff1*dnUdz-dnUdx(i-1,j,k1))+        &
-     &                        cff2*(cff2*dnUdz-dnUdx(i  ,j,k2))+        &
-     &                        cff3*(cff3*dnUdz-dnUdx(i-1,j,k2))+        &
-     &                        cff4*(cff4*dnUdz-dnUdx(i  ,j,k1)))
+                  cff1=MIN(dZdx_r(i-1,j,kw1),0.0_r8)
+                  cff2=MIN(dZdx_r(i  ,j,kw2),0.0_r8)
+                  cff3=MAX(dZdx_r(i-1,j,kw2),0.0_r8)
+                  cff4=MAX(dZdx_r(i  ,j,kw1),0.0_r8)
+                  UFsx(i,j,k4)=fac1*                                    &
+     &                         (cff1*(cff1*dnUdz-dnUdx(i-1,j,k3))+      &
+     &                          cff2*(cff2*dnUdz-dnUdx(i  ,j,k4))+      &
+     &                          cff3*(cff3*dnUdz-dnUdx(i-1,j,k4))+      &
+     &                          cff4*(cff4*dnUdz-dnUdx(i  ,j,k3)))
 
-                cff1=MIN(dZde_p(i,j  ,k1),0.0_r8)
-                cff2=MIN(dZde_p(i,j+1,k2),0.0_r8)
-                cff3=MAX(dZde_p(i,j  ,k2),0.0_r8)
-                cff4=MAX(dZde_p(i,j+1,k1),0.0_r8)
-                UFse(i,j,k2)=fac2*                                      &
-     &                       (cff1*(cff1*dmUdz-dmUde(i,j  ,k1))+        &
-     &                        cff2*(cff2*dmUdz-dmUde(i,j+1,k2))+        &
-     &                        cff3*(cff3*dmUdz-dmUde(i,j  ,k2))+        &
-     &                        cff4*(cff4*dmUdz-dmUde(i,j+1,k1)))
+                  cff1=MIN(dZde_p(i,j  ,kw1),0.0_r8)
+                  cff2=MIN(dZde_p(i,j+1,kw2),0.0_r8)
+                  cff3=MAX(dZde_p(i,j  ,kw2),0.0_r8)
+                  cff4=MAX(dZde_p(i,j+1,kw1),0.0_r8)
+                  UFse(i,j,k4)=fac2*                                    &
+     &                         (cff1*(cff1*dmUdz-dmUde(i,j  ,k3))+      &
+     &                          cff2*(cff2*dmUdz-dmUde(i,j+1,k4))+      &
+     &                          cff3*(cff3*dmUdz-dmUde(i,j  ,k4))+      &
+     &                          cff4*(cff4*dmUdz-dmUde(i,j+1,k3)))
 
-                cff1=MIN(dZde_p(i,j  ,k1),0.0_r8)
-                cff2=MIN(dZde_p(i,j+1,k2),0.0_r8)
-                cff3=MAX(dZde_p(i,j  ,k2),0.0_r8)
-                cff4=MAX(dZde_p(i,j+1,k1),0.0_r8)
-                cff5=MIN(dZdx_p(i,j  ,k1),0.0_r8)
-                cff6=MIN(dZdx_p(i,j+1,k2),0.0_r8)
-                cff7=MAX(dZdx_p(i,j  ,k2),0.0_r8)
-                cff8=MAX(dZdx_p(i,j+1,k1),0.0_r8)
-                UFsx(i,j,k2)=UFsx(i,j,k2)+                              &
-     &                       fac1*                                      &
-     &                       (cff1*(cff5*dnVdz-dnVdx(i,j  ,k1))+        &
-     &                        cff2*(cff6*dnVdz-dnVdx(i,j+1,k2))+        &
-     &                        cff3*(cff7*dnVdz-dnVdx(i,j  ,k2))+        &
-     &                        cff4*(cff8*dnVdz-dnVdx(i,j+1,k1)))
+                  cff1=MIN(dZde_p(i,j  ,kw1),0.0_r8)
+                  cff2=MIN(dZde_p(i,j+1,kw2),0.0_r8)
+                  cff3=MAX(dZde_p(i,j  ,kw2),0.0_r8)
+                  cff4=MAX(dZde_p(i,j+1,kw1),0.0_r8)
+                  cff5=MIN(dZdx_p(i,j  ,kw1),0.0_r8)
+                  cff6=MIN(dZdx_p(i,j+1,kw2),0.0_r8)
+                  cff7=MAX(dZdx_p(i,j  ,kw2),0.0_r8)
+                  cff8=MAX(dZdx_p(i,j+1,kw1),0.0_r8)
+                  UFsx(i,j,k4)=UFsx(i,j,k4)+                            &
+     &                         fac1*                                    &
+     &                         (cff1*(cff5*dnVdz-dnVdx(i,j  ,k3))+      &
+     &                          cff2*(cff6*dnVdz-dnVdx(i,j+1,k4))+      &
+     &                          cff3*(cff7*dnVdz-dnVdx(i,j  ,k4))+      &
+     &                          cff4*(cff8*dnVdz-dnVdx(i,j+1,k3)))
 
-                cff1=MIN(dZdx_r(i-1,j,k1),0.0_r8)
-                cff2=MIN(dZdx_r(i  ,j,k2),0.0_r8)
-                cff3=MAX(dZdx_r(i-1,j,k2),0.0_r8)
-                cff4=MAX(dZdx_r(i  ,j,k1),0.0_r8)
-                cff5=MIN(dZde_r(i-1,j,k1),0.0_r8)
-                cff6=MIN(dZde_r(i  ,j,k2),0.0_r8)
-                cff7=MAX(dZde_r(i-1,j,k2),0.0_r8)
-                cff8=MAX(dZde_r(i  ,j,k1),0.0_r8)
-                UFse(i,j,k2)=UFse(i,j,k2)-                              &
-     &                       fac2*                                      &
-     &                       (cff1*(cff5*dmVdz-dmVde(i-1,j,k1))+        &
-     &                        cff2*(cff6*dmVdz-dmVde(i  ,j,k2))+        &
-     &                        cff3*(cff7*dmVdz-dmVde(i-1,j,k2))+        &
-     &                        cff4*(cff8*dmVdz-dmVde(i  ,j,k1)))
+                  cff1=MIN(dZdx_r(i-1,j,kw1),0.0_r8)
+                  cff2=MIN(dZdx_r(i  ,j,kw2),0.0_r8)
+                  cff3=MAX(dZdx_r(i-1,j,kw2),0.0_r8)
+                  cff4=MAX(dZdx_r(i  ,j,kw1),0.0_r8)
+                  cff5=MIN(dZde_r(i-1,j,kw1),0.0_r8)
+                  cff6=MIN(dZde_r(i  ,j,kw2),0.0_r8)
+                  cff7=MAX(dZde_r(i-1,j,kw2),0.0_r8)
+                  cff8=MAX(dZde_r(i  ,j,kw1),0.0_r8)
+                  UFse(i,j,k4)=UFse(i,j,k4)-                            &
+     &                         fac2*                                    &
+     &                         (cff1*(cff5*dmVdz-dmVde(i-1,j,k3))+      &
+     &                          cff2*(cff6*dmVdz-dmVde(i  ,j,k4))+      &
+     &                          cff3*(cff7*dmVdz-dmVde(i-1,j,k4))+      &
+     &                          cff4*(cff8*dmVdz-dmVde(i  ,j,k3)))
+                END DO
               END DO
-            END DO
 !
-            DO j=JstrV,Jend
-              DO i=Istr,Iend
+              DO j=JstrV,Jend
+                DO i=Istr,Iend
 #ifdef VISC_3DCOEF
 # ifdef UV_U3ADV_SPLIT
-                cff=0.125_r8*                                           &
-     &              (Vvis3d_r(i,j-1,k  )+Vvis3d_r(i,j,k  )+             &
-     &               Vvis3d_r(i,j-1,k+1)+Vvis3d_r(i,j,k+1))
+                  cff=0.125_r8*                                         &
+     &                (Vvis3d_r(i,j-1,k  )+Vvis3d_r(i,j,k  )+           &
+     &                 Vvis3d_r(i,j-1,k+1)+Vvis3d_r(i,j,k+1))
 # else
-                cff=0.125_r8*                                           &
-     &              (visc3d_r(i,j-1,k  )+visc3d_r(i,j,k  )+             &
-     &               visc3d_r(i,j-1,k+1)+visc3d_r(i,j,k+1))
+                  cff=0.125_r8*                                         &
+     &                (visc3d_r(i,j-1,k  )+visc3d_r(i,j,k  )+           &
+     &                 visc3d_r(i,j-1,k+1)+visc3d_r(i,j,k+1))
 # endif
-                fac1=cff*on_v(i,j)
-                fac2=cff*om_v(i,j)
+                  fac1=cff*on_v(i,j)
+                  fac2=cff*om_v(i,j)
 #else
-                cff=0.25_r8*(visc4_r(i,j-1)+visc4_r(i,j))
-                fac1=cff*on_v(i,j)
-                fac2=cff*om_v(i,j)
+                  cff=0.25_r8*(visc4_r(i,j-1)+visc4_r(i,j))
+                  fac1=cff*on_v(i,j)
+                  fac2=cff*om_v(i,j)
 #endif
-                cff=0.5_r8*(pn(i,j-1)+pn(i,j))
-                dnUdz=cff*0.25_r8*(dUdz(i  ,j  ,k2)+                    &
-     &                             dUdz(i+1,j  ,k2)+                    &
-     &                             dUdz(i  ,j-1,k2)+                    &
-     &                             dUdz(i+1,j-1,k2))
-                dnVdz=cff*dVdz(i,j,k2)
-                cff=0.5_r8*(pm(i,j-1)+pm(i,j))
-                dmUdz=cff*0.25_r8*(dUdz(i  ,j  ,k2)+                    &
-     &                             dUdz(i+1,j  ,k2)+                    &
-     &                             dUdz(i  ,j-1,k2)+                    &
-     &                             dUdz(i+1,j-1,k2))
-                dmVdz=cff*dVdz(i,j,k2)
+                  cff=pn_v(i,j)
+                  dnUdz=cff*0.25_r8*(dUdz(i  ,j  ,k4)+                  &
+     &                               dUdz(i+1,j  ,k4)+                  &
+     &                               dUdz(i  ,j-1,k4)+                  &
+     &                               dUdz(i+1,j-1,k4))
+                  dnVdz=cff*dVdz(i,j,k4)
+                  cff=pm_v(i,j)
+                  dmUdz=cff*0.25_r8*(dUdz(i  ,j  ,k4)+                  &
+     &                               dUdz(i+1,j  ,k4)+                  &
+     &                               dUdz(i  ,j-1,k4)+                  &
+     &                               dUdz(i+1,j-1,k4))
+                  dmVdz=cff*dVdz(i,j,k4)
 
-                cff1=MIN(dZdx_p(i  ,j,k1),0.0_r8)
-                cff2=MIN(dZdx_p(i+1,j,k2),0.0_r8)
-                cff3=MAX(dZdx_p(i  ,j,k2),0.0_r8)
-                cff4=MAX(dZdx_p(i+1,j,k1),0.0_r8)
-                VFsx(i,j,k2)=fac1*                                      &
-     &                       (cff1*(cff1*dnVdz-dnVdx(i  ,j,k1))+        &
-     &                        cff2*(cff2*dnVdz-dnVdx(i+1,j,k2))+        &
-     &                        cff3*(cff3*dnVdz-dnVdx(i  ,j,k2))+        &
-     &                        cff4*(cff4*dnVdz-dnVdx(i+1,j,k1)))
+                  cff1=MIN(dZdx_p(i  ,j,kw1),0.0_r8)
+                  cff2=MIN(dZdx_p(i+1,j,kw2),0.0_r8)
+                  cff3=MAX(dZdx_p(i  ,j,kw2),0.0_r8)
+                  cff4=MAX(dZdx_p(i+1,j,kw1),0.0_r8)
+                  VFsx(i,j,k4)=fac1*                                    &
+     &                         (cff1*(cff1*dnVdz-dnVdx(i  ,j,k3))+      &
+     &                          cff2*(cff2*dnVdz-dnVdx(i+1,j,k4))+      &
+     &                          cff3*(cff3*dnVdz-dnVdx(i  ,j,k4))+      &
+     &                          cff4*(cff4*dnVdz-dnVdx(i+1,j,k3)))
 
-                cff1=MIN(dZde_r(i,j-1,k1),0.0_r8)
-                cff2=MIN(dZde_r(i,j  ,k2),0.0_r8)
-                cff3=MAX(dZde_r(i,j-1,k2),0.0_r8)
-                cff4=MAX(dZde_r(i,j  ,k1),0.0_r8)
-                VFse(i,j,k2)=fac2*                                      &
-     &                       (cff1*(cff1*dmVdz-dmVde(i,j-1,k1))+        &
-     &                        cff2*(cff2*dmVdz-dmVde(i,j  ,k2))+        &
-     &                        cff3*(cff3*dmVdz-dmVde(i,j-1,k2))+        &
-     &                        cff4*(cff4*dmVdz-dmVde(i,j  ,k1)))
+                  cff1=MIN(dZde_r(i,j-1,kw1),0.0_r8)
+                  cff2=MIN(dZde_r(i,j  ,kw2),0.0_r8)
+                  cff3=MAX(dZde_r(i,j-1,kw2),0.0_r8)
+                  cff4=MAX(dZde_r(i,j  ,kw1),0.0_r8)
+                  VFse(i,j,k4)=fac2*                                    &
+     &                         (cff1*(cff1*dmVdz-dmVde(i,j-1,k3))+      &
+     &                          cff2*(cff2*dmVdz-dmVde(i,j  ,k4))+      &
+     &                          cff3*(cff3*dmVdz-dmVde(i,j-1,k4))+      &
+     &                          cff4*(cff4*dmVdz-dmVde(i,j  ,k3)))
 
-                cff1=MIN(dZde_r(i,j-1,k1),0.0_r8)
-                cff2=MIN(dZde_r(i,j  ,k2),0.0_r8)
-                cff3=MAX(dZde_r(i,j-1,k2),0.0_r8)
-                cff4=MAX(dZde_r(i,j  ,k1),0.0_r8)
-                cff5=MIN(dZdx_r(i,j-1,k1),0.0_r8)
-                cff6=MIN(dZdx_r(i,j  ,k2),0.0_r8)
-                cff7=MAX(dZdx_r(i,j-1,k2),0.0_r8)
-                cff8=MAX(dZdx_r(i,j  ,k1),0.0_r8)
-                VFsx(i,j,k2)=VFsx(i,j,k2)-                              &
-     &                       fac1*                                      &
-     &                       (cff1*(cff5*dnUdz-dnUdx(i,j-1,k1))+        &
-     &                        cff2*(cff6*dnUdz-dnUdx(i,j  ,k2))+        &
-     &                        cff3*(cff7*dnUdz-dnUdx(i,j-1,k2))+        &
-     &                        cff4*(cff8*dnUdz-dnUdx(i,j  ,k1)))
+                  cff1=MIN(dZde_r(i,j-1,kw1),0.0_r8)
+                  cff2=MIN(dZde_r(i,j  ,kw2),0.0_r8)
+                  cff3=MAX(dZde_r(i,j-1,kw2),0.0_r8)
+                  cff4=MAX(dZde_r(i,j  ,kw1),0.0_r8)
+                  cff5=MIN(dZdx_r(i,j-1,kw1),0.0_r8)
+                  cff6=MIN(dZdx_r(i,j  ,kw2),0.0_r8)
+                  cff7=MAX(dZdx_r(i,j-1,kw2),0.0_r8)
+                  cff8=MAX(dZdx_r(i,j  ,kw1),0.0_r8)
+                  VFsx(i,j,k4)=VFsx(i,j,k4)-                            &
+     &                         fac1*                                    &
+     &                         (cff1*(cff5*dnUdz-dnUdx(i,j-1,k3))+      &
+     &                          cff2*(cff6*dnUdz-dnUdx(i,j  ,k4))+      &
+     &                          cff3*(cff7*dnUdz-dnUdx(i,j-1,k4))+      &
+     &                          cff4*(cff8*dnUdz-dnUdx(i,j  ,k3)))
 
-                cff1=MIN(dZdx_p(i  ,j,k1),0.0_r8)
-                cff2=MIN(dZdx_p(i+1,j,k2),0.0_r8)
-                cff3=MAX(dZdx_p(i  ,j,k2),0.0_r8)
-                cff4=MAX(dZdx_p(i+1,j,k1),0.0_r8)
-                cff5=MIN(dZde_p(i  ,j,k1),0.0_r8)
-                cff6=MIN(dZde_p(i+1,j,k2),0.0_r8)
-                cff7=MAX(dZde_p(i  ,j,k2),0.0_r8)
-                cff8=MAX(dZde_p(i+1,j,k1),0.0_r8)
-                VFse(i,j,k2)=VFse(i,j,k2)+                              &
-     &                       fac2*                                      &
-     &                       (cff1*(cff5*dmUdz-dmUde(i  ,j,k1))+        &
-     &                        cff2*(cff6*dmUdz-dmUde(i+1,j,k2))+        &
-     &                        cff3*(cff7*dmUdz-dmUde(i  ,j,k2))+        &
-     &                        cff4*(cff8*dmUdz-dmUde(i+1,j,k1)))
+                  cff1=MIN(dZdx_p(i  ,j,kw1),0.0_r8)
+                  cff2=MIN(dZdx_p(i+1,j,kw2),0.0_r8)
+                  cff3=MAX(dZdx_p(i  ,j,kw2),0.0_r8)
+                  cff4=MAX(dZdx_p(i+1,j,kw1),0.0_r8)
+                  cff5=MIN(dZde_p(i  ,j,kw1),0.0_r8)
+                  cff6=MIN(dZde_p(i+1,j,kw2),0.0_r8)
+                  cff7=MAX(dZde_p(i  ,j,kw2),0.0_r8)
+                  cff8=MAX(dZde_p(i+1,j,kw1),0.0_r8)
+                  VFse(i,j,k4)=VFse(i,j,k4)+                            &
+     &                         fac2*                                    &
+     &                         (cff1*(cff5*dmUdz-dmUde(i  ,j,k3))+      &
+     &                          cff2*(cff6*dmUdz-dmUde(i+1,j,k4))+      &
+     &                          cff3*(cff7*dmUdz-dmUde(i  ,j,k4))+      &
+     &                          cff4*(cff8*dmUdz-dmUde(i+1,j,k3)))
+                END DO
               END DO
-            END DO
-          END IF
+            END IF
 !
 !  Time-step biharmonic, geopotential viscosity term. Notice that
 !  momentum at this stage is HzU and HzV and has m2/s units.  Add
@@ -1414,53 +1369,54 @@
 !  terms because of the 2D/3D momentum coupling.
 #endif
 !
-          DO j=Jstr,Jend
-            DO i=IstrU,Iend
-              cff=dt(ng)*0.25_r8*(pm(i-1,j)+pm(i,j))*(pn(i-1,j)+pn(i,j))
-              cff1=0.5_r8*(pn(i-1,j)+pn(i,j))*(UFx(i,j  )-UFx(i-1,j))
-              cff2=0.5_r8*(pm(i-1,j)+pm(i,j))*(UFe(i,j+1)-UFe(i  ,j))
-              cff3=UFsx(i,j,k2)-UFsx(i,j,k1)
-              cff4=UFse(i,j,k2)-UFse(i,j,k1)
-              cff5=cff*(cff1+cff2)
-              cff6=dt(ng)*(cff3+cff4)
-              rufrc(i,j)=rufrc(i,j)-cff1-cff2-cff3-cff4
-              u(i,j,k,nnew)=u(i,j,k,nnew)-cff5-cff6
+            DO j=Jstr,Jend
+              DO i=IstrU,Iend
+                cff=dt(ng)*pm_u(i,j)*pn_u(i,j)
+                cff1=pn_u(i,j)*(UFx(i,j  )-UFx(i-1,j))
+                cff2=pm_u(i,j)*(UFe(i,j+1)-UFe(i  ,j))
+                cff3=UFsx(i,j,k4)-UFsx(i,j,k3)
+                cff4=UFse(i,j,k4)-UFse(i,j,k3)
+                cff5=cff*(cff1+cff2)
+                cff6=dt(ng)*(cff3+cff4)
+                rufrc(i,j)=rufrc(i,j)-cff1-cff2-cff3-cff4
+                u(i,j,k,nnew)=u(i,j,k,nnew)-cff5-cff6
 #ifdef DIAGNOSTICS_UV
-              DiaRUfrc(i,j,3,M2hvis)=DiaRUfrc(i,j,3,M2hvis)-cff1-cff2-  &
-     &                                                      cff3-cff4
-              DiaRUfrc(i,j,3,M2xvis)=DiaRUfrc(i,j,3,M2xvis)-cff1-cff3
-              DiaRUfrc(i,j,3,M2yvis)=DiaRUfrc(i,j,3,M2yvis)-cff2-cff4
-              DiaU3wrk(i,j,k,M3hvis)=-cff5-cff6
-              DiaU3wrk(i,j,k,M3xvis)=-cff*cff1-dt(ng)*cff3
-              DiaU3wrk(i,j,k,M3yvis)=-cff*cff2-dt(ng)*cff4
+                DiaRUfrc(i,j,3,M2hvis)=DiaRUfrc(i,j,3,M2hvis)-          &
+     &                                 cff1-cff2-cff3-cff4
+                DiaRUfrc(i,j,3,M2xvis)=DiaRUfrc(i,j,3,M2xvis)-cff1-cff3
+                DiaRUfrc(i,j,3,M2yvis)=DiaRUfrc(i,j,3,M2yvis)-cff2-cff4
+                DiaU3wrk(i,j,k,M3hvis)=-cff5-cff6
+                DiaU3wrk(i,j,k,M3xvis)=-cff*cff1-dt(ng)*cff3
+                DiaU3wrk(i,j,k,M3yvis)=-cff*cff2-dt(ng)*cff4
 #endif
+              END DO
             END DO
-          END DO
 
-          DO j=JstrV,Jend
-            DO i=Istr,Iend
-              cff=dt(ng)*0.25_r8*(pm(i,j)+pm(i,j-1))*(pn(i,j)+pn(i,j-1))
-              cff1=0.5_r8*(pn(i,j-1)+pn(i,j))*(VFx(i+1,j)-VFx(i,j  ))
-              cff2=0.5_r8*(pm(i,j-1)+pm(i,j))*(VFe(i  ,j)-VFe(i,j-1))
-              cff3=VFsx(i,j,k2)-VFsx(i,j,k1)
-              cff4=VFse(i,j,k2)-VFse(i,j,k1)
-              cff5=cff*(cff1-cff2)
-              cff6=dt(ng)*(cff3+cff4)
-              rvfrc(i,j)=rvfrc(i,j)-cff1+cff2-cff3-cff4
-              v(i,j,k,nnew)=v(i,j,k,nnew)-cff5-cff6
+            DO j=JstrV,Jend
+              DO i=Istr,Iend
+                cff=dt(ng)*pm_v(i,j)*pn_v(i,j)
+                cff1=pn_v(i,j)*(VFx(i+1,j)-VFx(i,j  ))
+                cff2=pm_v(i,j)*(VFe(i  ,j)-VFe(i,j-1))
+                cff3=VFsx(i,j,k4)-VFsx(i,j,k3)
+                cff4=VFse(i,j,k4)-VFse(i,j,k3)
+                cff5=cff*(cff1-cff2)
+                cff6=dt(ng)*(cff3+cff4)
+                rvfrc(i,j)=rvfrc(i,j)-cff1+cff2-cff3-cff4
+                v(i,j,k,nnew)=v(i,j,k,nnew)-cff5-cff6
 #ifdef DIAGNOSTICS_UV
-              DiaRVfrc(i,j,3,M2hvis)=DiaRVfrc(i,j,3,M2hvis)-cff1+cff2-  &
-     &                                                      cff3-cff4
-              DiaRVfrc(i,j,3,M2xvis)=DiaRVfrc(i,j,3,M2xvis)-cff1-cff3
-              DiaRVfrc(i,j,3,M2yvis)=DiaRVfrc(i,j,3,M2yvis)+cff2-cff4
-              DiaV3wrk(i,j,k,M3hvis)=-cff5-cff6
-              DiaV3wrk(i,j,k,M3xvis)=-cff*cff1-dt(ng)*cff3
-              DiaV3wrk(i,j,k,M3yvis)= cff*cff2-dt(ng)*cff4
+                DiaRVfrc(i,j,3,M2hvis)=DiaRVfrc(i,j,3,M2hvis)-          &
+     &                                 cff1+cff2-cff3-cff4
+                DiaRVfrc(i,j,3,M2xvis)=DiaRVfrc(i,j,3,M2xvis)-cff1-cff3
+                DiaRVfrc(i,j,3,M2yvis)=DiaRVfrc(i,j,3,M2yvis)+cff2-cff4
+                DiaV3wrk(i,j,k,M3hvis)=-cff5-cff6
+                DiaV3wrk(i,j,k,M3xvis)=-cff*cff1-dt(ng)*cff3
+                DiaV3wrk(i,j,k,M3yvis)= cff*cff2-dt(ng)*cff4
 #endif
+              END DO
             END DO
-          END DO
+          END IF
         END IF
-      END DO K_LOOP2
+      END DO K_LOOP
 
       RETURN
       END SUBROUTINE uv3dmix4_tile
@@ -69,9 +69,13 @@
      &                    GRID(ng) % on_p,                              &
      &                    GRID(ng) % on_r,                              &
      &                    GRID(ng) % pm,                                &
+     &                    GRID(ng) % pm_u,                              &
+     &                    GRID(ng) % pm_v,                              &
      &                    GRID(ng) % pmon_p,                            &
      &                    GRID(ng) % pmon_r,                            &
      &                    GRID(ng) % pn,                                &
+     &                    GRID(ng) % pn_u,                              &
+     &                    GRID(ng) % pn_v,                              &
      &                    GRID(ng) % pnom_p,                            &
      &                    GRID(ng) % pnom_r,                            &
 #ifdef VISC_3DCOEF
@@ -115,8 +119,8 @@
 #endif
      &                          Hz,                                     &
      &                          om_p, om_r, on_p, on_r,                 &
-     &                          pm, pmon_p, pmon_r,                     &
-     &                          pn, pnom_p, pnom_r,                     &
+     &                          pm, pm_u, pm_v, pmon_p, pmon_r,         &
+     &                          pn, pn_u, pn_v, pnom_p, pnom_r,         &
 #ifdef VISC_3DCOEF
 # ifdef UV_U3ADV_SPLIT
      &                          Uvis3d_r, Vvis3d_r,                     &
@@ -157,9 +161,13 @@
       real(r8), intent(in) :: on_p(LBi:,LBj:)
       real(r8), intent(in) :: on_r(LBi:,LBj:)
       real(r8), intent(in) :: pm(LBi:,LBj:)
+      real(r8), intent(in) :: pm_u(LBi:,LBj:)
+      real(r8), intent(in) :: pm_v(LBi:,LBj:)
       real(r8), intent(in) :: pmon_p(LBi:,LBj:)
       real(r8), intent(in) :: pmon_r(LBi:,LBj:)
       real(r8), intent(in) :: pn(LBi:,LBj:)
+      real(r8), intent(in) :: pn_u(LBi:,LBj:)
+      real(r8), intent(in) :: pn_v(LBi:,LBj:)
       real(r8), intent(in) :: pnom_p(LBi:,LBj:)
       real(r8), intent(in) :: pnom_r(LBi:,LBj:)
 # ifdef VISC_3DCOEF
@@ -197,9 +205,13 @@
       real(r8), intent(in) :: on_p(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: on_r(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: pm(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pm_u(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pm_v(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: pmon_p(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: pmon_r(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: pn(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pn_u(LBi:UBi,LBj:UBj)
+      real(r8), intent(in) :: pn_v(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: pnom_p(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: pnom_r(LBi:UBi,LBj:UBj)
 # ifdef VISC_3DCOEF
@@ -346,18 +358,16 @@
 !
         DO j=JminU,JmaxU
           DO i=IminU,ImaxU
-            LapU(i,j)=0.125_r8*                                         &
-     &                (pm(i-1,j)+pm(i,j))*(pn(i-1,j)+pn(i,j))*          &
-     &                ((pn(i-1,j)+pn(i,j))*(UFx(i,j  )-UFx(i-1,j))+     &
-     &                 (pm(i-1,j)+pm(i,j))*(UFe(i,j+1)-UFe(i  ,j)))
+            LapU(i,j)=pm_u(i,j)*pn_u(i,j)*                              &
+     &                (pn_u(i,j)*(UFx(i,j  )-UFx(i-1,j))+               &
+     &                 pm_u(i,j)*(UFe(i,j+1)-UFe(i  ,j)))
           END DO
         END DO
         DO j=JminV,JmaxV
           DO i=IminV,ImaxV
-            LapV(i,j)=0.125_r8*                                         &
-     &                (pm(i,j)+pm(i,j-1))*(pn(i,j)+pn(i,j-1))*          &
-     &                ((pn(i,j-1)+pn(i,j))*(VFx(i+1,j)-VFx(i,j  ))-     &
-     &                 (pm(i,j-1)+pm(i,j))*(VFe(i  ,j)-VFe(i,j-1)))
+            LapV(i,j)=pm_v(i,j)*pn_v(i,j)*                              &
+     &                (pn_v(i,j)*(VFx(i+1,j)-VFx(i,j  ))-               &
+     &                 pm_v(i,j)*(VFe(i  ,j)-VFe(i,j-1)))
           END DO
         END DO
 !
@@ -574,9 +584,9 @@
 !
         DO j=Jstr,Jend
           DO i=IstrU,Iend
-            cff=dt(ng)*0.25_r8*(pm(i-1,j)+pm(i,j))*(pn(i-1,j)+pn(i,j))
-            cff1=0.5_r8*(pn(i-1,j)+pn(i,j))*(UFx(i,j  )-UFx(i-1,j))
-            cff2=0.5_r8*(pm(i-1,j)+pm(i,j))*(UFe(i,j+1)-UFe(i  ,j))
+            cff=dt(ng)*pm_u(i,j)*pn_u(i,j)
+            cff1=pn_u(i,j)*(UFx(i,j  )-UFx(i-1,j))
+            cff2=pm_u(i,j)*(UFe(i,j+1)-UFe(i  ,j))
             cff3=cff*(cff1+cff2)
             rufrc(i,j)=rufrc(i,j)-cff1-cff2
             u(i,j,k,nnew)=u(i,j,k,nnew)-cff3
@@ -592,9 +602,9 @@
         END DO
         DO j=JstrV,Jend
           DO i=Istr,Iend
-            cff=dt(ng)*0.25_r8*(pm(i,j)+pm(i,j-1))*(pn(i,j)+pn(i,j-1))
-            cff1=0.5_r8*(pn(i,j-1)+pn(i,j))*(VFx(i+1,j)-VFx(i,j  ))
-            cff2=0.5_r8*(pm(i,j-1)+pm(i,j))*(VFe(i  ,j)-VFe(i,j-1))
+            cff=dt(ng)*pm_v(i,j)*pn_v(i,j)
+            cff1=pn_v(i,j)*(VFx(i+1,j)-VFx(i,j  ))
+            cff2=pm_v(i,j)*(VFe(i  ,j)-VFe(i,j-1))
             cff3=cff*(cff1-cff2)
             rvfrc(i,j)=rvfrc(i,j)-cff1+cff2
             v(i,j,k,nnew)=v(i,j,k,nnew)-cff3